@@ -76,7 +76,13 @@ void AnimateAnimatedTiles()
 {
 	PerformanceAccumulator landscape_framerate(PFE_GL_LANDSCAPE);
 
+	/* Animated tiles are scattered over the map, so request the map data of
+	 * the tiles a few entries ahead while the current one is animated. */
+	static const ptrdiff_t PREFETCH_DISTANCE = 8;
+
 	for (auto it = std::begin(_animated_tiles); it != std::end(_animated_tiles); /* nothing */) {
+		if (std::distance(it, std::end(_animated_tiles)) > PREFETCH_DISTANCE) Tile::Prefetch(*std::next(it, PREFETCH_DISTANCE));
+
 		TileIndex &tile = *it;
 
 		if (GetAnimatedTileState(tile) != AnimatedTileState::Animated) {
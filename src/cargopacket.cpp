@@ -385,13 +385,15 @@ void VehicleCargoList::AddToMeta(const CargoPacket *cp, MoveToAction action)
  */
 void VehicleCargoList::AgeCargo()
 {
-	for (const auto &cp : this->packets) {
+	uint64_t aged = 0;
+	for (CargoPacket *cp : this->packets) {
 		/* If we're at the maximum, then we can't increase no more. */
 		if (cp->periods_in_transit == UINT16_MAX) continue;
 
 		cp->periods_in_transit++;
-		this->cargo_periods_in_transit += cp->count;
+		aged += cp->count;
 	}
+	this->cargo_periods_in_transit += aged;
 }
 
 /**
@@ -1711,11 +1711,12 @@ static bool ConAlias(std::span<std::string_view> argv)
 static bool ConScreenShot(std::span<std::string_view> argv)
 {
 	if (argv.empty()) {
-		IConsolePrint(CC_HELP, "Create a screenshot of the game. Usage: 'screenshot [viewport | normal | big | giant | heightmap | minimap] [no_con] [size <width> <height>] [<filename>]'.");
+		IConsolePrint(CC_HELP, "Create a screenshot of the game. Usage: 'screenshot [viewport | normal | big | giant | tiles | heightmap | minimap] [no_con] [size <width> <height>] [<filename>]'.");
 		IConsolePrint(CC_HELP, "  'viewport' (default) makes a screenshot of the current viewport (including menus, windows).");
 		IConsolePrint(CC_HELP, "  'normal' makes a screenshot of the visible area.");
 		IConsolePrint(CC_HELP, "  'big' makes a zoomed-in screenshot of the visible area.");
 		IConsolePrint(CC_HELP, "  'giant' makes a screenshot of the whole map.");
+		IConsolePrint(CC_HELP, "  'tiles' makes a screenshot of the whole map as a directory of slippy map tiles, named <zoom>/<x>/<y>.");
 		IConsolePrint(CC_HELP, "  'heightmap' makes a heightmap screenshot of the map that can be loaded in as heightmap.");
 		IConsolePrint(CC_HELP, "  'minimap' makes a top-viewed minimap screenshot of the whole world which represents one tile by one pixel.");
 		IConsolePrint(CC_HELP, "  'no_con' hides the console to create the screenshot (only useful in combination with 'viewport').");
@@ -1745,6 +1746,9 @@ static bool ConScreenShot(std::span<std::string_view> argv)
 		} else if (argv[arg_index] == "giant") {
 			type = SC_WORLD;
 			arg_index += 1;
+		} else if (argv[arg_index] == "tiles") {
+			type = SC_WORLD_TILES;
+			arg_index += 1;
 		} else if (argv[arg_index] == "heightmap") {
 			type = SC_HEIGHTMAP;
 			arg_index += 1;
@@ -50,6 +50,7 @@ int _debug_sl_level;
 int _debug_gamelog_level;
 int _debug_desync_level;
 int _debug_console_level;
+int _debug_linkgraph_level;
 #ifdef RANDOM_DEBUG
 int _debug_random_level;
 #endif
@@ -75,6 +76,7 @@ static const std::initializer_list<DebugLevel> _debug_levels{
 	DEBUG_LEVEL(gamelog),
 	DEBUG_LEVEL(desync),
 	DEBUG_LEVEL(console),
+	DEBUG_LEVEL(linkgraph),
 #ifdef RANDOM_DEBUG
 	DEBUG_LEVEL(random),
 #endif
@@ -1031,6 +1031,13 @@ Money GetTransportedGoodsIncome(uint num_pieces, uint dist, uint16_t transit_per
 /** The industries we've currently brought cargo to. */
 static SmallIndustryList _cargo_delivery_destinations;
 
+/**
+ * Stations that (may) have vehicles in their loading queue. This is a superset
+ * of those stations; entries whose queue has become empty, or whose station has
+ * been removed, are dropped by #LoadUnloadStations.
+ */
+static std::set<StationID> _loading_stations;
+
 /**
  * Transfer goods from station to industry.
  * All cargo is delivered to the nearest (Manhattan) industry to the station sign, which is inside the acceptance rectangle and actually accepts the cargo.
@@ -1278,6 +1285,7 @@ void PrepareUnload(Vehicle *front_v)
 {
 	Station *curr_station = Station::Get(front_v->last_station_visited);
 	curr_station->loading_vehicles.push_back(front_v);
+	_loading_stations.insert(curr_station->index);
 
 	/* At this moment loading cannot be finished */
 	front_v->vehicle_flags.Reset(VehicleFlag::LoadingFinished);
@@ -1984,6 +1992,33 @@ void LoadUnloadStation(Station *st)
 	_cargo_delivery_destinations.clear();
 }
 
+/**
+ * Load/unload the vehicles at all stations with a non-empty loading queue.
+ * Stations are handled in index order, just like iterating the station pool would.
+ */
+void LoadUnloadStations()
+{
+	for (auto it = _loading_stations.begin(); it != _loading_stations.end(); /* nothing */) {
+		Station *st = Station::GetIfValid(*it);
+		if (st == nullptr || st->loading_vehicles.empty()) {
+			it = _loading_stations.erase(it);
+			continue;
+		}
+
+		LoadUnloadStation(st);
+		++it;
+	}
+}
+
+/** Rebuild the set of stations with vehicles loading, e.g. after loading a savegame. */
+void RebuildLoadingStations()
+{
+	_loading_stations.clear();
+	for (const Station *st : Station::Iterate()) {
+		if (!st->loading_vehicles.empty()) _loading_stations.insert(st->index);
+	}
+}
+
 /**
  * Every calendar month update of inflation.
  */
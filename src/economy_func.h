@@ -36,6 +36,8 @@ uint MoveGoodsToStation(CargoType cargo, uint amount, Source source, const Stati
 
 void PrepareUnload(Vehicle *front_v);
 void LoadUnloadStation(Station *st);
+void LoadUnloadStations();
+void RebuildLoadingStations();
 
 Money GetPrice(Price index, uint cost_factor, const struct GRFFile *grf_file, int shift = 0);
 
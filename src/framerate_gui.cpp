@@ -27,6 +27,7 @@
 #include "timer/timer.h"
 #include "timer/timer_window.h"
 #include "zoom_func.h"
+#include "spritecache.h"
 
 #include "widgets/framerate_widget.h"
 
@@ -201,9 +202,11 @@ namespace {
 		PerformanceData(1),                     // PFE_ACC_GL_SHIPS
 		PerformanceData(1),                     // PFE_ACC_GL_AIRCRAFT
 		PerformanceData(1),                     // PFE_GL_LANDSCAPE
+		PerformanceData(1),                     // PFE_GL_INDUSTRIES
 		PerformanceData(1),                     // PFE_GL_LINKGRAPH
 		PerformanceData(1000.0 / 30),           // PFE_DRAWING
 		PerformanceData(1),                     // PFE_ACC_DRAWWORLD
+		PerformanceData(1),                     // PFE_SPRITECACHE
 		PerformanceData(60.0),                  // PFE_VIDEO
 		PerformanceData(1000.0 * 8192 / 44100), // PFE_SOUND
 		PerformanceData(1),                     // PFE_ALLSCRIPTS
@@ -346,6 +349,7 @@ static const PerformanceElement DISPLAY_ORDER_PFE[PFE_MAX - 4] = {
 	// PFE_GL_SHIPS,
 	// PFE_GL_AIRCRAFT,
 	PFE_GL_LANDSCAPE,
+	PFE_GL_INDUSTRIES,
 	PFE_ALLSCRIPTS,
 	PFE_GAMESCRIPT,
 	PFE_AI0,
@@ -366,6 +370,7 @@ static const PerformanceElement DISPLAY_ORDER_PFE[PFE_MAX - 4] = {
 	PFE_GL_LINKGRAPH,
 	PFE_DRAWING,
 	PFE_DRAWWORLD,
+	PFE_SPRITECACHE,
 	PFE_VIDEO,
 	PFE_SOUND,
 };
@@ -604,6 +609,11 @@ struct FramerateWindow : Window {
 				y += GetCharacterHeight(FS_NORMAL);
 				drawable--;
 				if (drawable == 0) break;
+			} else if (e == PFE_SPRITECACHE) {
+				DrawString(r.left, r.right, y, GetString(STR_FRAMERATE_BYTES_GOOD, GetSpriteCacheUsage()), TC_FROMSTRING, SA_RIGHT | SA_FORCE);
+				y += GetCharacterHeight(FS_NORMAL);
+				drawable--;
+				if (drawable == 0) break;
 			} else {
 				/* skip non-script */
 				y += GetCharacterHeight(FS_NORMAL);
@@ -1012,9 +1022,11 @@ void ConPrintFramerate()
 		"  GL ship ticks",
 		"  GL aircraft ticks",
 		"  GL landscape ticks",
+		"  GL industry production",
 		"  GL link graph delays",
 		"Drawing",
 		"  Viewport drawing",
+		"  Sprite loading",
 		"Video output",
 		"Sound mixing",
 		"AI/GS scripts total",
@@ -1052,6 +1064,12 @@ void ConPrintFramerate()
 		printed_anything = true;
 	}
 
+	if (_pf_data[PFE_SPRITECACHE].num_valid > 0) {
+		const SpriteCacheStatistics &stats = GetSpriteCacheStatistics();
+		IConsolePrint(TC_LIGHT_BLUE, "Sprite cache: {} hits, {} misses, {} evictions, {} bytes in use",
+			stats.hits, stats.misses, stats.evictions, GetSpriteCacheUsage());
+	}
+
 	if (!printed_anything) {
 		IConsolePrint(CC_ERROR, "No performance measurements have been taken yet.");
 	}
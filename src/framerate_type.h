@@ -52,9 +52,11 @@ enum PerformanceElement : uint8_t {
 	PFE_GL_SHIPS,      ///< Time spent processing ships
 	PFE_GL_AIRCRAFT,   ///< Time spent processing aircraft
 	PFE_GL_LANDSCAPE,  ///< Time spent processing other world features
+	PFE_GL_INDUSTRIES, ///< Time spent processing industry production
 	PFE_GL_LINKGRAPH,  ///< Time spent waiting for link graph background jobs
 	PFE_DRAWING,       ///< Speed of drawing world and GUI.
 	PFE_DRAWWORLD,     ///< Time spent drawing world viewports in GUI
+	PFE_SPRITECACHE,   ///< Time spent loading sprites into the sprite cache
 	PFE_VIDEO,         ///< Speed of painting drawn video buffer.
 	PFE_SOUND,         ///< Speed of mixing audio samples
 	PFE_ALLSCRIPTS,    ///< Sum of all GS/AI scripts
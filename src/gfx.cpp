@@ -610,6 +610,7 @@ static int DrawLayoutLine(const ParagraphLayouter::Line &line, int y, int left,
 			const ParagraphLayouter::VisualRun &run = line.GetVisualRun(run_index);
 			const auto &glyphs = run.GetGlyphs();
 			const auto &positions = run.GetPositions();
+			const auto &sprites = run.GetGlyphSprites();
 			const Font *f = run.GetFont();
 
 			FontCache *fc = f->fc;
@@ -634,7 +635,7 @@ static int DrawLayoutLine(const ParagraphLayouter::Line &line, int y, int left,
 				/* Truncated away. */
 				if (truncation && (begin_x < min_x || end_x > max_x)) continue;
 
-				const Sprite *sprite = fc->GetGlyph(glyph);
+				const Sprite *sprite = sprites[i];
 				/* Check clipping (the "+ 1" is for the shadow). */
 				if (begin_x + sprite->x_offs > dpi_right || begin_x + sprite->x_offs + sprite->width /* - 1 + 1 */ < dpi_left) continue;
 
@@ -1464,7 +1465,7 @@ void RedrawScreenRect(int left, int top, int right, int bottom)
 }
 
 static std::vector<Rect> _dirty_viewport_occlusions;
-static const Viewport *_dirty_viewport;
+static Viewport *_dirty_viewport;
 static NWidgetDisplayFlags _dirty_viewport_disp_flags;
 
 static void DrawDirtyViewport(uint occlusion, int left, int top, int right, int bottom)
@@ -1509,7 +1510,7 @@ static void DrawDirtyViewport(uint occlusion, int left, int top, int right, int
 	if (_game_mode == GM_MENU) {
 		RedrawScreenRect(left, top, right, bottom);
 	} else {
-		extern void ViewportDrawChk(const Viewport &vp, int left, int top, int right, int bottom);
+		extern void ViewportDrawChk(Viewport &vp, int left, int top, int right, int bottom);
 		ViewportDrawChk(*_dirty_viewport, left, top, right, bottom);
 
 		if (_dirty_viewport_disp_flags.Any({NWidgetDisplayFlag::ShadeGrey, NWidgetDisplayFlag::ShadeDimmed})) {
@@ -14,6 +14,7 @@
 #include "strings_func.h"
 #include "core/utf8.hpp"
 #include "debug.h"
+#include "spritecache.h"
 
 #include "table/control_codes.h"
 
@@ -201,6 +202,32 @@ Layouter::Layouter(std::string_view str, int maxw, FontSize fontsize) : string(s
 	}
 }
 
+/**
+ * Get the sprites of all glyphs of this run.
+ * Runs live in the line cache, so a string that is drawn every frame only looks up its glyphs once.
+ * The line cache is reset whenever a font cache is cleared; sprites of sprite fonts may also be
+ * evicted from the sprite cache, so they are looked up again once the sprite cache dropped any sprite.
+ * Loading sprites never evicts others, so the returned sprites stay valid until the next #IncreaseSpriteLRU.
+ * @return Glyph sprites in the order of #GetGlyphs, \c nullptr for empty glyphs.
+ */
+std::span<const Sprite * const> ParagraphLayouter::VisualRun::GetGlyphSprites() const
+{
+	const auto glyphs = this->GetGlyphs();
+	const uint32_t generation = GetSpriteCacheGeneration();
+
+	if (this->glyph_sprites_generation != generation || this->glyph_sprites.size() != glyphs.size()) {
+		FontCache *fc = this->GetFont()->fc;
+		this->glyph_sprites.clear();
+		this->glyph_sprites.reserve(glyphs.size());
+		for (GlyphID glyph : glyphs) {
+			this->glyph_sprites.push_back(glyph == 0xFFFF ? nullptr : fc->GetGlyph(glyph));
+		}
+		this->glyph_sprites_generation = generation;
+	}
+
+	return this->glyph_sprites;
+}
+
 /**
  * Get the boundaries of this paragraph.
  * @return The boundaries.
@@ -127,6 +127,8 @@ public:
 
 	/** Visual run contains data about the bit of text with the same font. */
 	class VisualRun {
+		mutable std::vector<const Sprite *> glyph_sprites; ///< Sprites of the glyphs, resolved by #GetGlyphSprites.
+		mutable uint32_t glyph_sprites_generation = 0; ///< Sprite cache generation #glyph_sprites were resolved at.
 	public:
 		virtual ~VisualRun() = default;
 		virtual const Font *GetFont() const = 0;
@@ -135,6 +137,8 @@ public:
 		virtual std::span<const Position> GetPositions() const = 0;
 		virtual int GetLeading() const = 0;
 		virtual std::span<const int> GetGlyphToCharMap() const = 0;
+
+		std::span<const Sprite * const> GetGlyphSprites() const;
 	};
 
 	/** A single line worth of VisualRuns. */
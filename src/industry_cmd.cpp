@@ -50,6 +50,7 @@
 #include "timer/timer_game_calendar.h"
 #include "timer/timer_game_economy.h"
 #include "timer/timer_game_tick.h"
+#include "framerate_type.h"
 
 #include "table/strings.h"
 #include "table/industry_land.h"
@@ -1251,6 +1252,8 @@ void OnTick_Industry()
 
 	if (_game_mode == GM_EDITOR) return;
 
+	PerformanceAccumulator framerate(PFE_GL_INDUSTRIES);
+
 	for (Industry *i : Industry::Iterate()) {
 		ProduceIndustryGoods(i);
 
@@ -3132,6 +3135,8 @@ static void ChangeIndustryProduction(Industry *i, bool monthly)
  */
 static const IntervalTimer<TimerGameEconomy> _economy_industries_daily({TimerGameEconomy::DAY, TimerGameEconomy::Priority::INDUSTRY}, [](auto)
 {
+	PerformanceAccumulator framerate(PFE_GL_INDUSTRIES);
+
 	_economy.industry_daily_change_counter += _economy.industry_daily_increment;
 
 	/* Bits 16-31 of industry_construction_counter contain the number of industries to change/create today,
@@ -3174,6 +3179,8 @@ static const IntervalTimer<TimerGameEconomy> _economy_industries_daily({TimerGam
 
 static const IntervalTimer<TimerGameEconomy> _economy_industries_monthly({TimerGameEconomy::MONTH, TimerGameEconomy::Priority::INDUSTRY}, [](auto)
 {
+	PerformanceAccumulator framerate(PFE_GL_INDUSTRIES);
+
 	Backup<CompanyID> cur_company(_current_company, OWNER_NONE);
 
 	_industry_builder.EconomyMonthlyLoop();
@@ -100,8 +100,9 @@ public:
 		 */
 		EdgeAnnotation &operator[](NodeID to)
 		{
-			auto it = std::ranges::find_if(this->edges, [=] (const EdgeAnnotation &e) { return e.base.dest_node == to; });
-			assert(it != this->edges.end());
+			/* Edges are copied from the link graph node, so they are sorted by destination as well. */
+			auto it = std::ranges::lower_bound(this->edges, to, std::less{}, [] (const EdgeAnnotation &e) { return e.base.dest_node; });
+			assert(it != this->edges.end() && it->base.dest_node == to);
 			return *it;
 		}
 
@@ -112,8 +113,9 @@ public:
 		 */
 		const EdgeAnnotation &operator[](NodeID to) const
 		{
-			auto it = std::ranges::find_if(this->edges, [=] (const EdgeAnnotation &e) { return e.base.dest_node == to; });
-			assert(it != this->edges.end());
+			/* Edges are copied from the link graph node, so they are sorted by destination as well. */
+			auto it = std::ranges::lower_bound(this->edges, to, std::less{}, [] (const EdgeAnnotation &e) { return e.base.dest_node; });
+			assert(it != this->edges.end() && it->base.dest_node == to);
 			return *it;
 		}
 
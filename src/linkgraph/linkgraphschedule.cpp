@@ -17,6 +17,7 @@
 #include "../command_func.h"
 #include "../network/network.h"
 #include "../misc_cmd.h"
+#include "../debug.h"
 
 #include "../safeguards.h"
 
@@ -86,9 +87,26 @@ void LinkGraphSchedule::JoinNext()
  */
 /* static */ void LinkGraphSchedule::Run(LinkGraphJob *job)
 {
-	for (const auto &handler : instance.handlers) {
+	static const std::array<std::string_view, std::tuple_size_v<decltype(instance.handlers)>> handler_names = {
+		"init", "demands", "mcf1", "flows1", "mcf2", "flows2"
+	};
+
+	std::string timings;
+	auto job_start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < instance.handlers.size(); ++i) {
 		if (job->IsJobAborted()) return;
-		handler->Run(*job);
+
+		auto start = std::chrono::steady_clock::now();
+		instance.handlers[i]->Run(*job);
+		if (_debug_linkgraph_level >= 1) {
+			auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+			format_append(timings, ", {} {} us", handler_names[i], duration.count());
+		}
+	}
+
+	if (_debug_linkgraph_level >= 1) {
+		auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - job_start);
+		Debug(linkgraph, 1, "Job for link graph {} (cargo {}, {} nodes) took {} us{}", job->LinkGraphIndex(), job->Cargo(), job->Size(), duration.count(), timings);
 	}
 
 	/*
@@ -7,6 +7,118 @@
 
 typedef std::vector<Path *> PathVector;
 
+/**
+ * Binary heap of annotations, ordered by the annotation's comparator. Unlike
+ * a std::set it does not allocate per node, and it knows the position of
+ * every node so that a node's entry can be updated in place. The comparator
+ * gives a strict total order, so nodes are taken in the same order as from
+ * a std::set.
+ * @tparam Tannotation Annotation to be used.
+ */
+template <class Tannotation>
+class AnnotationQueue {
+	static constexpr uint NOT_QUEUED = UINT_MAX; ///< Position of nodes not in the queue.
+
+	std::vector<Path *> &heap; ///< The heap itself.
+	std::vector<uint> &index;  ///< Position of each node in the heap.
+
+	/**
+	 * Check whether one annotation goes before another one.
+	 * @param a First position in the heap.
+	 * @param b Second position in the heap.
+	 * @return True if the annotation at \a a goes first.
+	 */
+	inline bool Before(uint a, uint b) const
+	{
+		return typename Tannotation::Comparator()(static_cast<Tannotation *>(this->heap[a]), static_cast<Tannotation *>(this->heap[b]));
+	}
+
+	/**
+	 * Exchange two entries of the heap.
+	 * @param a First position in the heap.
+	 * @param b Second position in the heap.
+	 */
+	inline void Swap(uint a, uint b)
+	{
+		std::swap(this->heap[a], this->heap[b]);
+		this->index[this->heap[a]->GetNode()] = a;
+		this->index[this->heap[b]->GetNode()] = b;
+	}
+
+	/**
+	 * Move an entry to its place in the heap.
+	 * @param pos Position of the entry.
+	 */
+	void Fix(uint pos)
+	{
+		while (pos > 0 && this->Before(pos, (pos - 1) / 2)) {
+			this->Swap(pos, (pos - 1) / 2);
+			pos = (pos - 1) / 2;
+		}
+
+		for (;;) {
+			uint best = pos;
+			uint child = pos * 2 + 1;
+			if (child < this->heap.size() && this->Before(child, best)) best = child;
+			if (child + 1 < this->heap.size() && this->Before(child + 1, best)) best = child + 1;
+			if (best == pos) return;
+			this->Swap(pos, best);
+			pos = best;
+		}
+	}
+
+public:
+	/**
+	 * Create an empty queue on reusable storage.
+	 * @param heap Storage for the heap.
+	 * @param index Storage for the node positions.
+	 * @param size Number of nodes in the graph.
+	 */
+	AnnotationQueue(std::vector<Path *> &heap, std::vector<uint> &index, uint size) : heap(heap), index(index)
+	{
+		this->heap.clear();
+		this->index.assign(size, NOT_QUEUED);
+	}
+
+	/**
+	 * Check whether the queue is empty.
+	 * @return True if no node is queued.
+	 */
+	inline bool IsEmpty() const
+	{
+		return this->heap.empty();
+	}
+
+	/**
+	 * Add an annotation to the queue, or move it to its new place if its value changed.
+	 * @param anno Annotation to add or update.
+	 */
+	void Update(Tannotation *anno)
+	{
+		uint pos = this->index[anno->GetNode()];
+		if (pos == NOT_QUEUED) {
+			pos = static_cast<uint>(this->heap.size());
+			this->heap.push_back(anno);
+			this->index[anno->GetNode()] = pos;
+		}
+		this->Fix(pos);
+	}
+
+	/**
+	 * Remove the first annotation from the queue.
+	 * @return The removed annotation.
+	 */
+	Tannotation *Pop()
+	{
+		Tannotation *first = static_cast<Tannotation *>(this->heap.front());
+		this->Swap(0, static_cast<uint>(this->heap.size()) - 1);
+		this->heap.pop_back();
+		this->index[first->GetNode()] = NOT_QUEUED;
+		if (!this->heap.empty()) this->Fix(0);
+		return first;
+	}
+};
+
 /**
  * Multi-commodity flow calculating base class.
  */
@@ -29,6 +141,9 @@ protected:
 
 	LinkGraphJob &job;   ///< Job we're working with.
 	uint max_saturation; ///< Maximum saturation for edges.
+
+	std::vector<Path *> queue; ///< Priority queue of the Dijkstra algorithm, kept to reuse its memory.
+	std::vector<uint> queue_index; ///< Position of each node in #queue, kept to reuse its memory.
 };
 
 /**
@@ -198,6 +198,19 @@ public:
 	{
 		return extended_tiles[this->tile.base()].m8;
 	}
+
+	/**
+	 * Ask the CPU to start loading the map data of a tile that is going to be used shortly.
+	 * Nothing is read, so this is only a hint for access patterns the hardware cannot predict.
+	 * @param tile The tile to prefetch; it must be within the map.
+	 */
+	static inline void Prefetch([[maybe_unused]] TileIndex tile)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(&base_tiles[tile.base()]);
+		__builtin_prefetch(&extended_tiles[tile.base()]);
+#endif
+	}
 };
 
 /**
@@ -496,6 +496,7 @@ void ResetNewGRFData()
 
 	InitializeSoundPool();
 	_spritegroup_pool.CleanPool();
+	ClearNewGRFCallbackCache();
 	ResetCallbacks(false);
 }
 
@@ -59,8 +59,10 @@ void NewGRFProfiler::BeginResolve(const ResolverObject &resolver)
 
 /**
  * Capture the completion of a sprite group resolution.
+ * @param result  Result of the resolution
+ * @param cached  Whether the result was taken from the callback cache
  */
-void NewGRFProfiler::EndResolve(const ResolverResult &result)
+void NewGRFProfiler::EndResolve(const ResolverResult &result, bool cached)
 {
 	using namespace std::chrono;
 	this->cur_call.time = (uint32_t)time_point_cast<microseconds>(high_resolution_clock::now()).time_since_epoch().count() - this->cur_call.time;
@@ -88,6 +90,7 @@ void NewGRFProfiler::EndResolve(const ResolverResult &result)
 		}
 	};
 	this->cur_call.result = std::visit(visitor{}, result);
+	this->cur_call.cached = cached;
 
 	this->calls.push_back(this->cur_call);
 }
@@ -111,6 +114,11 @@ uint32_t NewGRFProfiler::Finish()
 {
 	if (!this->active) return 0;
 
+	if (this->cache_hits + this->cache_misses > 0) {
+		IConsolePrint(CC_DEBUG, "Callback cache of NewGRF [{:08X}]: {} hits, {} misses ({}% hit rate).", std::byteswap(this->grffile->grfid),
+				this->cache_hits, this->cache_misses, this->cache_hits * 100 / (this->cache_hits + this->cache_misses));
+	}
+
 	if (this->calls.empty()) {
 		IConsolePrint(CC_DEBUG, "Finished profile of NewGRF [{:08X}], no events collected, not writing a file.", std::byteswap(this->grffile->grfid));
 
@@ -128,9 +136,9 @@ uint32_t NewGRFProfiler::Finish()
 	if (!f.has_value()) {
 		IConsolePrint(CC_ERROR, "Failed to open '{}' for writing.", filename);
 	} else {
-		fmt::print(*f, "Tick,Sprite,Feature,Item,CallbackID,Microseconds,Depth,Result\n");
+		fmt::print(*f, "Tick,Sprite,Feature,Item,CallbackID,Microseconds,Depth,Result,Cached\n");
 		for (const Call &c : this->calls) {
-			fmt::print(*f, "{},{},0x{:X},{},0x{:X},{},{},{}\n", c.tick, c.root_sprite, c.feat, c.item, (uint)c.cb, c.time, c.subs, c.result);
+			fmt::print(*f, "{},{},0x{:X},{},0x{:X},{},{},{},{}\n", c.tick, c.root_sprite, c.feat, c.item, (uint)c.cb, c.time, c.subs, c.result, c.cached ? 1 : 0);
 			total_microseconds += c.time;
 		}
 	}
@@ -143,6 +151,8 @@ void NewGRFProfiler::Abort()
 {
 	this->active = false;
 	this->calls.clear();
+	this->cache_hits = 0;
+	this->cache_misses = 0;
 }
 
 /**
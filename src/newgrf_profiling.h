@@ -24,7 +24,7 @@ struct NewGRFProfiler {
 	~NewGRFProfiler();
 
 	void BeginResolve(const ResolverObject &resolver);
-	void EndResolve(const ResolverResult &result);
+	void EndResolve(const ResolverResult &result, bool cached = false);
 	void RecursiveResolve();
 
 	void Start();
@@ -46,6 +46,7 @@ struct NewGRFProfiler {
 		uint64_t tick;         ///< Game tick
 		CallbackID cb;       ///< Callback ID
 		GrfSpecFeature feat; ///< GRF feature being resolved for
+		bool cached;         ///< Result was taken from the callback cache, without resolving any sprite group
 	};
 
 	const GRFFile *grffile = nullptr; ///< Which GRF is being profiled
@@ -53,6 +54,8 @@ struct NewGRFProfiler {
 	uint64_t start_tick = 0; ///< Tick number this profiler was started on
 	Call cur_call{}; ///< Data for current call in progress
 	std::vector<Call> calls{}; ///< All calls collected so far
+	uint64_t cache_hits = 0; ///< Callbacks answered from the callback cache
+	uint64_t cache_misses = 0; ///< Callbacks that had to be resolved despite the callback cache
 };
 
 extern std::vector<NewGRFProfiler> _newgrf_profilers;
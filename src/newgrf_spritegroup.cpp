@@ -11,8 +11,11 @@
 #include "debug.h"
 #include "newgrf_spritegroup.h"
 #include "newgrf_profiling.h"
+#include "settings_type.h"
 #include "core/pool_func.hpp"
 
+#include <unordered_map>
+
 #include "safeguards.h"
 
 SpriteGroupPool _spritegroup_pool("SpriteGroup");
@@ -21,6 +24,99 @@ INSTANTIATE_POOL_METHODS(SpriteGroup)
 /* static */ TemporaryStorageArray<int32_t, 0x110> ResolverObject::temp_store;
 
 
+/** Key of a memoised callback result. */
+struct CallbackCacheKey {
+	const SpriteGroup *group; ///< Root sprite group that was resolved.
+	CallbackID callback; ///< Callback that was resolved.
+	uint32_t param1; ///< First parameter (var 10) of the callback.
+	uint32_t param2; ///< Second parameter (var 18) of the callback.
+
+	bool operator==(const CallbackCacheKey &other) const = default;
+};
+
+/** Hash function for #CallbackCacheKey. */
+struct CallbackCacheKeyHash {
+	size_t operator()(const CallbackCacheKey &key) const
+	{
+		size_t h = std::hash<const SpriteGroup *>{}(key.group);
+		h = h * 31 + key.callback;
+		h = h * 31 + key.param1;
+		h = h * 31 + key.param2;
+		return h;
+	}
+};
+
+/** Memoised result of a callback. */
+struct CallbackCacheEntry {
+	ResolverResult result; ///< Result of the resolution.
+	uint32_t last_value; ///< Value of ResolverObject::last_value after the resolution.
+};
+
+/** Maximum number of memoised callback results before the cache is flushed. */
+static const size_t CALLBACK_CACHE_MAX_SIZE = 1 << 16;
+
+/** Memoised results of callbacks whose result only depends on the callback and its parameters. */
+static std::unordered_map<CallbackCacheKey, CallbackCacheEntry, CallbackCacheKeyHash> _callback_cache;
+
+/**
+ * Forget all memoised callback results. Must be called when the sprite groups are freed.
+ */
+void ClearNewGRFCallbackCache()
+{
+	_callback_cache.clear();
+}
+
+/**
+ * Get the active profiler of a NewGRF.
+ * @param grf NewGRF to get the profiler of.
+ * @return The profiler, or nullptr if the NewGRF is not being profiled.
+ */
+static NewGRFProfiler *GetActiveProfiler(const GRFFile *grf)
+{
+	auto profiler = std::ranges::find(_newgrf_profilers, grf, &NewGRFProfiler::grffile);
+	if (profiler == _newgrf_profilers.end() || !profiler->active) return nullptr;
+	return &*profiler;
+}
+
+/**
+ * Resolve the root sprite group, using the memoised result if possible.
+ * Results are only memoised if the resolution read nothing but the callback ID, its
+ * parameters, registers it wrote itself and NewGRF parameters, and did not write any
+ * registers or persistent storage. Such a result cannot change until the NewGRFs are
+ * reloaded, so using it gives exactly the same outcome as resolving the chain again.
+ * @return The resolved result.
+ */
+ResolverResult ResolverObject::ResolveRoot()
+{
+	if (!_settings_client.gui.cm_newgrf_callback_cache || this->root_spritegroup == nullptr ||
+			this->callback == CBID_NO_CALLBACK || this->callback == CBID_RANDOM_TRIGGER) {
+		return SpriteGroup::Resolve(this->root_spritegroup, *this);
+	}
+
+	NewGRFProfiler *profiler = GetActiveProfiler(this->grffile);
+
+	CallbackCacheKey key{this->root_spritegroup, this->callback, this->callback_param1, this->callback_param2};
+	auto it = _callback_cache.find(key);
+	if (it != _callback_cache.end()) {
+		/* Cached calls are profiled like resolved ones, so the profile still shows every call. */
+		if (profiler != nullptr) {
+			profiler->cache_hits++;
+			profiler->BeginResolve(*this);
+		}
+		this->last_value = it->second.last_value;
+		if (profiler != nullptr) profiler->EndResolve(it->second.result, true);
+		return it->second.result;
+	}
+
+	if (profiler != nullptr) profiler->cache_misses++;
+	auto result = SpriteGroup::Resolve(this->root_spritegroup, *this);
+	if (this->cacheable) {
+		if (_callback_cache.size() >= CALLBACK_CACHE_MAX_SIZE) _callback_cache.clear();
+		_callback_cache.emplace(key, CallbackCacheEntry{result, this->last_value});
+	}
+	return result;
+}
+
 /**
  * ResolverObject (re)entry point.
  * This cannot be made a call to a virtual function because virtual functions
@@ -35,10 +131,9 @@ INSTANTIATE_POOL_METHODS(SpriteGroup)
 {
 	if (group == nullptr) return std::monostate{};
 
-	const GRFFile *grf = object.grffile;
-	auto profiler = std::ranges::find(_newgrf_profilers, grf, &NewGRFProfiler::grffile);
+	NewGRFProfiler *profiler = GetActiveProfiler(object.grffile);
 
-	if (profiler == _newgrf_profilers.end() || !profiler->active) {
+	if (profiler == nullptr) {
 		return group->Resolve(object);
 	} else if (top_level) {
 		profiler->BeginResolve(object);
@@ -51,7 +146,7 @@ INSTANTIATE_POOL_METHODS(SpriteGroup)
 	}
 }
 
-static inline uint32_t GetVariable(const ResolverObject &object, ScopeResolver *scope, uint8_t variable, uint32_t parameter, bool &available)
+static inline uint32_t GetVariable(ResolverObject &object, ScopeResolver *scope, uint8_t variable, uint32_t parameter, bool &available)
 {
 	uint32_t value;
 	switch (variable) {
@@ -60,7 +155,12 @@ static inline uint32_t GetVariable(const ResolverObject &object, ScopeResolver *
 		case 0x18: return object.callback_param2;
 		case 0x1C: return object.last_value;
 
-		case 0x5F: return (scope->GetRandomBits() << 8) | scope->GetRandomTriggers();
+		/* Constant, commonly used to load an immediate value; no need to go through the global variables. */
+		case 0x1A: return UINT_MAX;
+
+		case 0x5F:
+			object.cacheable = false;
+			return (scope->GetRandomBits() << 8) | scope->GetRandomTriggers();
 
 		case 0x7D: return object.GetRegister(parameter);
 
@@ -69,6 +169,9 @@ static inline uint32_t GetVariable(const ResolverObject &object, ScopeResolver *
 			return object.grffile->GetParam(parameter);
 
 		default:
+			/* Everything else depends on the game state. */
+			object.cacheable = false;
+
 			/* First handle variables common with Action7/9/D */
 			if (variable < 0x40 && GetGlobalVariable(variable, &value, object.grffile)) return value;
 			/* Not a common variable, so evaluate the feature specific variables */
@@ -164,9 +267,9 @@ static U EvalAdjustT(const DeterministicSpriteGroupAdjust &adjust, ResolverObjec
 		case DSGA_OP_AND:  return last_value & value;
 		case DSGA_OP_OR:   return last_value | value;
 		case DSGA_OP_XOR:  return last_value ^ value;
-		case DSGA_OP_STO:  object.SetRegister((U)value, (S)last_value); return last_value;
+		case DSGA_OP_STO:  object.cacheable = false; object.SetRegister((U)value, (S)last_value); return last_value;
 		case DSGA_OP_RST:  return value;
-		case DSGA_OP_STOP: scope->StorePSA((U)value, (S)last_value); return last_value;
+		case DSGA_OP_STOP: object.cacheable = false; scope->StorePSA((U)value, (S)last_value); return last_value;
 		case DSGA_OP_ROR:  return std::rotr<uint32_t>((U)last_value, (U)value & 0x1F); // mask 'value' to 5 bits, which should behave the same on all architectures.
 		case DSGA_OP_SCMP: return ((S)last_value == (S)value) ? 1 : ((S)last_value < (S)value ? 0 : 2);
 		case DSGA_OP_UCMP: return ((U)last_value == (U)value) ? 1 : ((U)last_value < (U)value ? 0 : 2);
@@ -183,16 +286,24 @@ static bool RangeHighComparator(const DeterministicSpriteGroupRange &range, uint
 	return range.high < value;
 }
 
-/* virtual */ ResolverResult DeterministicSpriteGroup::Resolve(ResolverObject &object) const
+/**
+ * Evaluate the adjustment chain of a deterministic sprite group.
+ * The operand size is a template parameter, so the size dispatch happens once per
+ * chain instead of once per adjustment.
+ * U is the unsigned type and S is the signed type to use.
+ * @param adjusts Adjustments to evaluate.
+ * @param object Resolver object.
+ * @param scope Scope to evaluate the variables in.
+ * @param[out] last_value Result of the chain.
+ * @return false if an unavailable variable was read, true otherwise.
+ */
+template <typename U, typename S>
+static bool EvalAdjustChainT(std::span<const DeterministicSpriteGroupAdjust> adjusts, ResolverObject &object, ScopeResolver *scope, uint32_t &last_value)
 {
-	uint32_t last_value = 0;
-	uint32_t value = 0;
-
-	ScopeResolver *scope = object.GetScope(this->var_scope);
-
-	for (const auto &adjust : this->adjusts) {
+	for (const auto &adjust : adjusts) {
 		/* Try to get the variable. We shall assume it is available, unless told otherwise. */
 		bool available = true;
+		uint32_t value;
 		if (adjust.variable == 0x7E) {
 			auto subgroup = SpriteGroup::Resolve(adjust.subroutine, object, false);
 			auto *subvalue = std::get_if<CallbackResult>(&subgroup);
@@ -205,21 +316,34 @@ static bool RangeHighComparator(const DeterministicSpriteGroupRange &range, uint
 			value = GetVariable(object, scope, adjust.variable, adjust.parameter, available);
 		}
 
-		if (!available) {
-			/* Unsupported variable: skip further processing and return either
-			 * the group from the first range or the default group. */
-			return SpriteGroup::Resolve(this->error_group, object, false);
-		}
+		if (!available) return false;
 
-		switch (this->size) {
-			case DSG_SIZE_BYTE:  value = EvalAdjustT<uint8_t,  int8_t> (adjust, object, scope, last_value, value); break;
-			case DSG_SIZE_WORD:  value = EvalAdjustT<uint16_t, int16_t>(adjust, object, scope, last_value, value); break;
-			case DSG_SIZE_DWORD: value = EvalAdjustT<uint32_t, int32_t>(adjust, object, scope, last_value, value); break;
-			default: NOT_REACHED();
-		}
-		last_value = value;
+		last_value = EvalAdjustT<U, S>(adjust, object, scope, last_value, value);
 	}
+	return true;
+}
 
+/* virtual */ ResolverResult DeterministicSpriteGroup::Resolve(ResolverObject &object) const
+{
+	uint32_t last_value = 0;
+
+	ScopeResolver *scope = object.GetScope(this->var_scope);
+
+	bool available;
+	switch (this->size) {
+		case DSG_SIZE_BYTE:  available = EvalAdjustChainT<uint8_t,  int8_t> (this->adjusts, object, scope, last_value); break;
+		case DSG_SIZE_WORD:  available = EvalAdjustChainT<uint16_t, int16_t>(this->adjusts, object, scope, last_value); break;
+		case DSG_SIZE_DWORD: available = EvalAdjustChainT<uint32_t, int32_t>(this->adjusts, object, scope, last_value); break;
+		default: NOT_REACHED();
+	}
+
+	if (!available) {
+		/* Unsupported variable: skip further processing and return either
+		 * the group from the first range or the default group. */
+		return SpriteGroup::Resolve(this->error_group, object, false);
+	}
+
+	uint32_t value = last_value;
 	object.last_value = last_value;
 
 	auto result = this->default_result;
@@ -248,6 +372,8 @@ static bool RangeHighComparator(const DeterministicSpriteGroupRange &range, uint
 
 /* virtual */ ResolverResult RandomizedSpriteGroup::Resolve(ResolverObject &object) const
 {
+	object.cacheable = false;
+
 	ScopeResolver *scope = object.GetScope(this->var_scope, this->count);
 	if (object.callback == CBID_RANDOM_TRIGGER) {
 		/* Handle triggers */
@@ -275,7 +401,9 @@ static bool RangeHighComparator(const DeterministicSpriteGroupRange &range, uint
 {
 	/* Call the feature specific evaluation via ResultSpriteGroup::ResolveReal.
 	 * The result is either ResultSpriteGroup, CallbackResultSpriteGroup, or nullptr.
+	 * It depends on the state of the object, e.g. the load state of a vehicle.
 	 */
+	object.cacheable = false;
 	return SpriteGroup::Resolve(object.ResolveReal(*this), object, false);
 }
 
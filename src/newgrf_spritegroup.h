@@ -310,9 +310,12 @@ public:
 		this->last_value = 0;
 		this->used_random_triggers = 0;
 		this->reseed.fill(0);
-		return SpriteGroup::Resolve(this->root_spritegroup, *this);
+		this->cacheable = true;
+		return this->ResolveRoot();
 	}
 
+	ResolverResult ResolveRoot();
+
 	ScopeResolver default_scope; ///< Default implementation of the grf scope.
 
 	/**
@@ -342,6 +345,7 @@ public:
 	uint32_t callback_param2 = 0; ///< Second parameter (var 18) of the callback.
 
 	uint32_t last_value = 0; ///< Result of most recent DeterministicSpriteGroup (including procedure calls)
+	bool cacheable = true; ///< Whether the result so far only depends on the callback and its parameters, see #ResolveRoot.
 
 protected:
 	uint32_t waiting_random_triggers = 0; ///< Waiting triggers to be used by any rerandomisation. (scope independent)
@@ -469,4 +473,6 @@ struct SpecializedResolverObject : public ResolverObject {
 	}
 };
 
+void ClearNewGRFCallbackCache();
+
 #endif /* NEWGRF_SPRITEGROUP_H */
@@ -24,19 +24,51 @@ public:
 	using Key = typename Titem::Key;
 
 protected:
-	std::deque<Titem> items; ///< Storage of the nodes.
+	using Storage = std::deque<Titem>;
+
+	std::unique_ptr<Storage> items; ///< Storage of the nodes, borrowed from the pool of this thread.
+	size_t used = 0; ///< Number of nodes in use in #items; entries beyond are left over from an earlier search.
 	HashTable<Titem, Thash_bits_open> open_nodes; ///< Hash table of pointers to open nodes.
 	HashTable<Titem, Thash_bits_closed> closed_nodes; ///< Hash table of pointers to closed nodes.
 	CBinaryHeapT<Titem> open_queue; ///< Priority queue of pointers to open nodes.
 	Titem *new_node; ///< New node under construction.
 
 public:
+	/**
+	 * Node storage that is not in use by any node list of this thread.
+	 * Reusing it saves allocating and freeing the storage for each search.
+	 * @return The pool of this thread.
+	 */
+	static std::vector<std::unique_ptr<Storage>> &StoragePool()
+	{
+		thread_local std::vector<std::unique_ptr<Storage>> pool;
+		return pool;
+	}
+
 	/** default constructor */
 	NodeList() : open_queue(2048)
 	{
 		this->new_node = nullptr;
+
+		auto &pool = StoragePool();
+		if (pool.empty()) {
+			this->items = std::make_unique<Storage>();
+		} else {
+			this->items = std::move(pool.back());
+			pool.pop_back();
+		}
 	}
 
+	~NodeList()
+	{
+		/* Only a handful of searches run nested, so only keep a handful of storages around. */
+		auto &pool = StoragePool();
+		if (pool.size() < 4) pool.push_back(std::move(this->items));
+	}
+
+	NodeList(const NodeList &) = delete;
+	NodeList &operator=(const NodeList &) = delete;
+
 	/** return number of open nodes */
 	inline int OpenCount()
 	{
@@ -52,13 +84,22 @@ public:
 	/** return the total number of nodes. */
 	inline int TotalCount()
 	{
-		return this->items.Length();
+		return static_cast<int>(this->used);
 	}
 
 	/** allocate new data item from items */
 	inline Titem &CreateNewNode()
 	{
-		if (this->new_node == nullptr) this->new_node = &this->items.emplace_back();
+		if (this->new_node == nullptr) {
+			if (this->used < this->items->size()) {
+				Titem &item = (*this->items)[this->used];
+				item = Titem{};
+				this->new_node = &item;
+			} else {
+				this->new_node = &this->items->emplace_back();
+			}
+			this->used++;
+		}
 		return *this->new_node;
 	}
 
@@ -134,14 +175,18 @@ public:
 	/** Get a particular item. */
 	inline Titem &ItemAt(int index)
 	{
-		return this->items[index];
+		assert(static_cast<size_t>(index) < this->used);
+		return (*this->items)[index];
 	}
 
 	/** Helper for creating output of this array. */
 	template <class D>
 	void Dump(D &dmp) const
 	{
-		dmp.WriteStructT("data", &this->items);
+		dmp.WriteValue("num_items", this->used);
+		for (size_t i = 0; i < this->used; i++) {
+			dmp.WriteStructT(fmt::format("item[{}]", i), &(*this->items)[i]);
+		}
 	}
 };
 
@@ -15,6 +15,10 @@
 #include "fileio_func.h"
 #include "string_func.h"
 
+#ifdef UNIX
+#	include <sys/mman.h>
+#endif
+
 #include "safeguards.h"
 
 /**
@@ -42,9 +46,39 @@ RandomAccessFile::RandomAccessFile(std::string_view filename, Subdirectory subdi
 	this->simplified_filename = name_without_path.substr(0, name_without_path.rfind('.'));
 	strtolower(this->simplified_filename);
 
+	this->MapFile();
 	this->SeekTo(static_cast<size_t>(pos), SEEK_SET);
 }
 
+RandomAccessFile::~RandomAccessFile()
+{
+#ifdef UNIX
+	if (this->mapping != nullptr) munmap(this->mapping, this->mapping_size);
+#endif
+}
+
+/**
+ * Try to map the file into memory, so reads are served straight from the mapping
+ * instead of being copied through the stdio buffer and the local buffer.
+ * When the file can not be mapped, reading falls back to buffered reads.
+ */
+void RandomAccessFile::MapFile()
+{
+#ifdef UNIX
+	if (this->end_pos == 0) return;
+
+	/* For files within a tar-file this maps the tar-file up to the end of this file. */
+	void *mapping = mmap(nullptr, this->end_pos, PROT_READ, MAP_PRIVATE, fileno(*this->file_handle), 0);
+	if (mapping == MAP_FAILED) {
+		Debug(misc, 1, "Mapping {} into memory failed, using buffered reads", this->filename);
+		return;
+	}
+
+	this->mapping = static_cast<uint8_t *>(mapping);
+	this->mapping_size = this->end_pos;
+#endif
+}
+
 /**
  * Get the filename of the opened file with the path from the SubDirectory and the extension.
  * @return Name of the file.
@@ -91,6 +125,14 @@ void RandomAccessFile::SeekTo(size_t pos, int mode)
 {
 	if (mode == SEEK_CUR) pos += this->GetPos();
 
+	if (this->mapping != nullptr) {
+		/* The whole mapping acts as the read buffer, so pos is always its end. */
+		this->pos = this->mapping_size;
+		this->buffer = this->mapping + std::min(pos, this->mapping_size);
+		this->buffer_end = this->mapping + this->mapping_size;
+		return;
+	}
+
 	this->pos = pos;
 	if (fseek(*this->file_handle, this->pos, SEEK_SET) < 0) {
 		Debug(misc, 0, "Seeking in {} failed", this->filename);
@@ -107,6 +149,9 @@ void RandomAccessFile::SeekTo(size_t pos, int mode)
 uint8_t RandomAccessFile::ReadByte()
 {
 	if (this->buffer == this->buffer_end) {
+		/* With a mapped file the end of the buffer is the end of the file. */
+		if (this->mapping != nullptr) return 0;
+
 		this->buffer = this->buffer_start;
 		size_t size = fread(this->buffer, 1, RandomAccessFile::BUFFER_SIZE, *this->file_handle);
 		this->pos += size;
@@ -153,6 +198,8 @@ void RandomAccessFile::ReadBlock(void *ptr, size_t size)
 		ptr = static_cast<char *>(ptr) + to_copy;
 	}
 
+	if (this->mapping != nullptr) return;
+
 	this->pos += fread(ptr, 1, size, *this->file_handle);
 }
 
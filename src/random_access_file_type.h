@@ -35,12 +35,17 @@ class RandomAccessFile {
 	uint8_t *buffer_end;                ///< Last valid byte of buffer.
 	uint8_t buffer_start[BUFFER_SIZE];  ///< Local buffer when read from file.
 
+	uint8_t *mapping = nullptr;         ///< Start of the file mapped into memory, or \c nullptr when reading via #file_handle.
+	size_t mapping_size = 0;            ///< Number of mapped bytes, i.e. up to #end_pos.
+
+	void MapFile();
+
 public:
 	RandomAccessFile(std::string_view filename, Subdirectory subdir);
 	RandomAccessFile(const RandomAccessFile&) = delete;
 	void operator=(const RandomAccessFile&) = delete;
 
-	virtual ~RandomAccessFile() = default;
+	virtual ~RandomAccessFile();
 
 	const std::string &GetFilename() const;
 	const std::string &GetSimplifiedFilename() const;
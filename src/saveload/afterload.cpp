@@ -3454,6 +3454,7 @@ bool AfterLoadGame()
 	/* Restore the signals */
 	ResetSignalHandlers();
 
+	RebuildLoadingStations();
 	AfterLoadLinkGraphs();
 	AfterLoadFindBTProCBInfo();
 	citymania::InitializeZoningMap();
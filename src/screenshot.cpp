@@ -128,7 +128,7 @@ static void LargeWorldCallback(Viewport &vp, void *buf, uint y, uint pitch, uint
 /**
  * Construct a pathname for a screenshot file.
  * @param default_fn Default filename.
- * @param ext        Extension to use.
+ * @param ext        Extension to use, or empty for a name without extension (e.g. a directory).
  * @param crashlog   Create path for crash.png
  * @return Pathname for a screenshot file.
  */
@@ -152,7 +152,7 @@ static std::string_view MakeScreenshotName(std::string_view default_fn, std::str
 
 	size_t len = _screenshot_name.size();
 	/* Add extension to screenshot file */
-	format_append(_screenshot_name, ".{}", ext);
+	if (!ext.empty()) format_append(_screenshot_name, ".{}", ext);
 
 	std::string_view screenshot_dir = crashlog ? _personal_dir : FiosGetScreenshotDir();
 
@@ -163,7 +163,8 @@ static std::string_view MakeScreenshotName(std::string_view default_fn, std::str
 		if (!FileExists(_full_screenshot_path)) break;
 		/* If file exists try another one with same name, but just with a higher index */
 		_screenshot_name.erase(len);
-		format_append(_screenshot_name, "#{}.{}", serial, ext);
+		format_append(_screenshot_name, "#{}", serial);
+		if (!ext.empty()) format_append(_screenshot_name, ".{}", ext);
 	}
 
 	return _full_screenshot_path;
@@ -285,6 +286,61 @@ static bool MakeLargeWorldScreenshot(ScreenshotType t, uint32_t width = 0, uint3
 			}, vp.width, vp.height, BlitterFactory::GetCurrentBlitter()->GetScreenDepth(), _cur_palette.palette);
 }
 
+static const uint WORLD_TILE_SIZE = 256; ///< Width and height of a single image of a tiled world screenshot, as used by slippy maps.
+
+/**
+ * Make a screenshot of the whole map as a pyramid of image tiles, as used by slippy maps.
+ * Every zoom level allowed by the client settings, from the world screenshot zoom level outwards, is a
+ * level of the pyramid. A tile is stored as "<level>/<x>/<y>.<ext>" in a directory named after the
+ * screenshot, level 0 being the most zoomed out one. Tiles at the south and east edges are padded to full size.
+ * @return true on success
+ */
+static bool MakeTiledWorldScreenshot()
+{
+	auto provider = GetScreenshotProvider();
+	if (provider == nullptr) return false;
+
+	const Viewport world = SetupScreenshotViewport(SC_WORLD);
+
+	std::string dir = fmt::format("{}{}", MakeScreenshotName(SCREENSHOT_NAME, {}), PATHSEP);
+	uint depth = BlitterFactory::GetCurrentBlitter()->GetScreenDepth();
+
+	/* Sprites are only available for the zoom levels the client allows. */
+	const ZoomLevel zoom_min = std::max(ZoomLevel::WorldScreenshot, _settings_client.gui.zoom_min);
+	const ZoomLevel zoom_max = std::min(ZoomLevel::Max, _settings_client.gui.zoom_max);
+
+	for (ZoomLevel zoom = zoom_min; zoom <= zoom_max; ++zoom) {
+		int level = to_underlying(zoom_max) - to_underlying(zoom);
+		uint columns = CeilDiv(UnScaleByZoom(world.virtual_width, zoom), WORLD_TILE_SIZE);
+		uint rows = CeilDiv(UnScaleByZoom(world.virtual_height, zoom), WORLD_TILE_SIZE);
+
+		for (uint column = 0; column != columns; column++) {
+			std::string column_dir = fmt::format("{}{}{}{}{}", dir, level, PATHSEP, column, PATHSEP);
+			FioCreateDirectory(column_dir);
+
+			for (uint row = 0; row != rows; row++) {
+				Viewport vp{};
+				vp.zoom = zoom;
+				vp.virtual_left = world.virtual_left + ScaleByZoom(column * WORLD_TILE_SIZE, zoom);
+				vp.virtual_top = world.virtual_top + ScaleByZoom(row * WORLD_TILE_SIZE, zoom);
+				vp.virtual_width = ScaleByZoom(WORLD_TILE_SIZE, zoom);
+				vp.virtual_height = ScaleByZoom(WORLD_TILE_SIZE, zoom);
+				vp.width = WORLD_TILE_SIZE;
+				vp.height = WORLD_TILE_SIZE;
+				UpdateViewportSizeZoom(vp);
+
+				bool ok = provider->MakeImage(fmt::format("{}{}.{}", column_dir, row, provider->GetName()),
+						[&](void *buf, uint y, uint pitch, uint n) {
+							LargeWorldCallback(vp, buf, y, pitch, n);
+						}, vp.width, vp.height, depth, _cur_palette.palette);
+				if (!ok) return false;
+			}
+		}
+	}
+
+	return true;
+}
+
 /**
  * Callback for generating a heightmap. Supports 8bpp greyscale only.
  * @param buffer   Destination buffer.
@@ -427,6 +483,10 @@ static bool RealMakeScreenshot(ScreenshotType t, const std::string &name, uint32
 			ret = MakeMinimapWorldScreenshot();
 			break;
 
+		case SC_WORLD_TILES:
+			ret = MakeTiledWorldScreenshot();
+			break;
+
 		default:
 			NOT_REACHED();
 	}
@@ -21,6 +21,7 @@ enum ScreenshotType : uint8_t {
 	SC_WORLD,       ///< World screenshot.
 	SC_HEIGHTMAP,   ///< Heightmap of the world.
 	SC_MINIMAP,     ///< Minimap screenshot.
+	SC_WORLD_TILES, ///< World screenshot as a pyramid of image tiles for a slippy map.
 };
 
 bool MakeHeightmapScreenshot(std::string_view filename);
@@ -12,9 +12,11 @@
 #include "debug.h"
 #include "fileio_func.h"
 #include "screenshot_type.h"
+#include "thread.h"
 #include "3rdparty/fmt/ranges.h"
 
 #include <png.h>
+#include <condition_variable>
 
 #ifdef PNG_TEXT_SUPPORTED
 #include "rev.h"
@@ -142,24 +144,51 @@ public:
 		/* use by default 64k temp memory */
 		maxlines = Clamp(65536 / w, 16, 128);
 
-		/* now generate the bitmap bits */
-		std::vector<uint8_t> buff(static_cast<size_t>(w) * maxlines * bpp); // by default generate 128 lines at a time.
+		/* now generate the bitmap bits; two buffers, so the next block can be rendered while the previous one is compressed. */
+		const size_t row_size = static_cast<size_t>(w) * bpp;
+		std::array<std::vector<uint8_t>, 2> buffs;
+		for (auto &buff : buffs) buff.resize(row_size * maxlines); // by default generate 128 lines at a time.
 
+		PngRowWriter writer(png_ptr, row_size);
+		std::thread writer_thread;
+		bool threaded = StartNewThread(&writer_thread, "ottd:png", [&writer]() { writer.Run(); });
+
+		uint cur = 0;
 		y = 0;
 		do {
 			/* determine # lines to write */
 			n = std::min(h - y, maxlines);
 
 			/* render the pixels into the buffer */
-			callb(buff.data(), y, w, n);
+			callb(buffs[cur].data(), y, w, n);
 			y += n;
 
-			/* write them to png */
-			for (i = 0; i != n; i++) {
-				png_write_row(png_ptr, (png_bytep)buff.data() + i * w * bpp);
+			/* write them to png, either by handing them to the writer thread or directly */
+			if (threaded) {
+				if (!writer.Submit(buffs[cur].data(), n)) break;
+				cur ^= 1;
+			} else if (!PngRowWriter::WriteRows(png_ptr, buffs[cur].data(), n, row_size)) {
+				writer.failed = true;
+				break;
 			}
 		} while (y != h);
 
+		if (threaded) {
+			writer.Finish();
+			writer_thread.join();
+		}
+
+		if (writer.failed) {
+			png_destroy_write_struct(&png_ptr, &info_ptr);
+			return false;
+		}
+
+		/* Re-arm the error handler; the writer may have left it pointing to its own, now gone, stack frame. */
+		if (setjmp(png_jmpbuf(png_ptr))) {
+			png_destroy_write_struct(&png_ptr, &info_ptr);
+			return false;
+		}
+
 		png_write_end(png_ptr, info_ptr);
 		png_destroy_write_struct(&png_ptr, &info_ptr);
 
@@ -167,6 +196,84 @@ public:
 	}
 
 private:
+	/** Compresses blocks of rendered rows on a separate thread, so rendering and compression overlap. */
+	struct PngRowWriter {
+		png_structp png_ptr; ///< The PNG being written.
+		size_t row_size; ///< Size of a single row in bytes.
+
+		std::mutex lock; ///< Guards the members below.
+		std::condition_variable cv; ///< Signalled whenever a block is submitted or completed.
+		const uint8_t *rows = nullptr; ///< Block waiting to be written, or \c nullptr when idle.
+		uint count = 0; ///< Number of rows in #rows.
+		bool done = false; ///< No more blocks will be submitted.
+		bool failed = false; ///< libpng reported an error; the image is unusable.
+
+		PngRowWriter(png_structp png_ptr, size_t row_size) : png_ptr(png_ptr), row_size(row_size) {}
+
+		/**
+		 * Write a block of rows to the PNG.
+		 * @param png_ptr The PNG being written.
+		 * @param rows The first row.
+		 * @param count Number of rows.
+		 * @param row_size Size of a single row in bytes.
+		 * @return \c false if libpng reported an error.
+		 */
+		static bool WriteRows(png_structp png_ptr, const uint8_t *rows, uint count, size_t row_size)
+		{
+			if (setjmp(png_jmpbuf(png_ptr))) return false;
+
+			for (uint i = 0; i != count; i++) {
+				png_write_row(png_ptr, rows + i * row_size);
+			}
+			return true;
+		}
+
+		/**
+		 * Hand a block of rows to the writer thread. Waits for the previous block to be written first.
+		 * The block must stay valid until the next call to #Submit or #Finish.
+		 * @param block The first row.
+		 * @param n Number of rows.
+		 * @return \c false if writing has failed.
+		 */
+		bool Submit(const uint8_t *block, uint n)
+		{
+			std::unique_lock<std::mutex> guard(this->lock);
+			this->cv.wait(guard, [this] { return this->rows == nullptr; });
+			if (this->failed) return false;
+			this->rows = block;
+			this->count = n;
+			this->cv.notify_all();
+			return true;
+		}
+
+		/** Wait for the last block to be written and tell the writer thread to stop. */
+		void Finish()
+		{
+			std::unique_lock<std::mutex> guard(this->lock);
+			this->cv.wait(guard, [this] { return this->rows == nullptr; });
+			this->done = true;
+			this->cv.notify_all();
+		}
+
+		/** Main loop of the writer thread. */
+		void Run()
+		{
+			std::unique_lock<std::mutex> guard(this->lock);
+			for (;;) {
+				this->cv.wait(guard, [this] { return this->rows != nullptr || this->done; });
+				if (this->rows == nullptr) return;
+
+				guard.unlock();
+				bool ok = WriteRows(this->png_ptr, this->rows, this->count, this->row_size);
+				guard.lock();
+
+				if (!ok) this->failed = true;
+				this->rows = nullptr;
+				this->cv.notify_all();
+			}
+		}
+	};
+
 	static void PNGAPI png_my_error(png_structp png_ptr, png_const_charp message)
 	{
 		Debug(misc, 0, "[libpng] error: {} - {}", message, *static_cast<std::string_view *>(png_get_error_ptr(png_ptr)));
@@ -678,6 +678,7 @@ SettingsContainer &GetSettingsTree()
 				general->Add(new SettingEntry("gui.cm_remove_mod"));
 				general->Add(new SettingEntry("gui.cm_estimate_mod"));
 				general->Add(new SettingEntry("gui.cm_show_apm"));
+				general->Add(new SettingEntry("gui.cm_newgrf_callback_cache"));
 			}
 
 			SettingsPage *viewports = interface->Add(new SettingsPage(STR_CONFIG_SETTING_INTERFACE_VIEWPORTS));
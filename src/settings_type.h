@@ -300,6 +300,7 @@ struct GUISettings {
 	bool cm_enable_polyrail_terraform;
 	bool cm_invert_fn_for_signal_drag;
 	bool cm_toolbar_dropdown_close;
+	bool cm_newgrf_callback_cache; ///< memoise NewGRF callback results that only depend on the callback parameters
 	/* CityMania code end */
 
 	/**
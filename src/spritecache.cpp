@@ -17,6 +17,7 @@
 #include "blitter/factory.hpp"
 #include "core/math_func.hpp"
 #include "video/video_driver.hpp"
+#include "framerate_type.h"
 #include "spritecache.h"
 #include "spritecache_internal.h"
 
@@ -31,6 +32,8 @@ uint _sprite_cache_size = 4;
 
 static std::vector<SpriteCache> _spritecache;
 static size_t _spritecache_bytes_used = 0;
+static SpriteCacheStatistics _spritecache_stats;
+static uint32_t _spritecache_generation = 1; ///< Changed every time sprite data is removed from the cache.
 static uint32_t _sprite_lru_counter;
 static std::vector<std::unique_ptr<SpriteFile>> _sprite_files;
 
@@ -754,6 +757,7 @@ static void DeleteEntriesFromSpriteCache(size_t to_remove)
 	for (const auto &it : candidates) {
 		GetSpriteCache(it.id)->ClearSpriteData();
 	}
+	_spritecache_stats.evictions += candidates.size();
 
 	Debug(sprite, 3, "DeleteEntriesFromSpriteCache, deleted: {}, freed: {}, in use: {} --> {}, requested: {}",
 			candidates.size(), candidate_bytes, initial_in_use, _spritecache_bytes_used, to_remove);
@@ -783,8 +787,38 @@ void IncreaseSpriteLRU()
 	}
 }
 
+/**
+ * Get the usage statistics of the sprite cache.
+ * @return Hit, miss and eviction counters.
+ */
+const SpriteCacheStatistics &GetSpriteCacheStatistics()
+{
+	return _spritecache_stats;
+}
+
+/**
+ * Get the amount of memory used by sprites in the sprite cache.
+ * @return Number of bytes used.
+ */
+size_t GetSpriteCacheUsage()
+{
+	return _spritecache_bytes_used;
+}
+
+/**
+ * Get the generation of the sprite cache.
+ * The generation changes whenever sprite data is removed, so a sprite pointer obtained
+ * while the generation was the same is still valid.
+ * @return The current generation.
+ */
+uint32_t GetSpriteCacheGeneration()
+{
+	return _spritecache_generation;
+}
+
 void SpriteCache::ClearSpriteData()
 {
+	_spritecache_generation++;
 	_spritecache_bytes_used -= this->length;
 	this->ptr.reset();
 }
@@ -876,6 +910,9 @@ void *GetRawSprite(SpriteID sprite, SpriteType type, SpriteAllocator *allocator,
 
 		/* Load the sprite, if it is not loaded, yet */
 		if (sc->ptr == nullptr) {
+			PerformanceAccumulator framerate(PFE_SPRITECACHE);
+			_spritecache_stats.misses++;
+
 			UniquePtrSpriteAllocator cache_allocator;
 			if (sc->type == SpriteType::Recolour) {
 				ReadRecolourSprite(*sc->file, sc->file_pos, sc->length, cache_allocator);
@@ -885,6 +922,8 @@ void *GetRawSprite(SpriteID sprite, SpriteType type, SpriteAllocator *allocator,
 			sc->ptr = std::move(cache_allocator.data);
 			sc->length = static_cast<uint32_t>(cache_allocator.size);
 			_spritecache_bytes_used += sc->length;
+		} else {
+			_spritecache_stats.hits++;
 		}
 
 		return static_cast<void *>(sc->ptr.get());
@@ -902,6 +941,7 @@ void GfxInitSpriteMem()
 
 	_sprite_files.clear();
 	_spritecache_bytes_used = 0;
+	_spritecache_stats = {};
 }
 
 /**
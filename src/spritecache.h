@@ -25,6 +25,13 @@ protected:
 	void *AllocatePtr(size_t size) override;
 };
 
+/** Usage statistics of the sprite cache, counted since the sprite cache was (re)initialised. */
+struct SpriteCacheStatistics {
+	uint64_t hits = 0; ///< Number of requests served from the cache.
+	uint64_t misses = 0; ///< Number of requests that had to read and decode the sprite.
+	uint64_t evictions = 0; ///< Number of sprites removed from the cache to make room for others.
+};
+
 void *GetRawSprite(SpriteID sprite, SpriteType type, SpriteAllocator *allocator = nullptr, SpriteEncoder *encoder = nullptr);
 bool SpriteExists(SpriteID sprite);
 
@@ -51,6 +58,9 @@ void GfxInitSpriteMem();
 void GfxClearSpriteCache();
 void GfxClearFontSpriteCache();
 void IncreaseSpriteLRU();
+const SpriteCacheStatistics &GetSpriteCacheStatistics();
+size_t GetSpriteCacheUsage();
+uint32_t GetSpriteCacheGeneration();
 
 SpriteFile &OpenCachedSpriteFile(const std::string &filename, Subdirectory subdir, bool palette_remap);
 std::span<const std::unique_ptr<SpriteFile>> GetCachedSpriteFiles();
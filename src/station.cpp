@@ -65,6 +65,8 @@ BaseStation::~BaseStation()
 	this->sign.MarkDirty();
 }
 
+static void ResetCatchmentIndex();
+
 Station::Station(TileIndex tile) :
 	SpecializedStation<Station, false>(tile),
 	bus_station(INVALID_TILE, 0, 0),
@@ -96,6 +98,7 @@ Station::~Station()
 	}
 
 	if (CleaningPool()) {
+		ResetCatchmentIndex();
 		for (GoodsEntry &ge : this->goods) {
 			if (!ge.HasData()) continue;
 			ge.GetData().cargo.OnCleanPool();
@@ -103,6 +106,8 @@ Station::~Station()
 		return;
 	}
 
+	this->RemoveFromCatchmentIndex();
+
 	while (!this->loading_vehicles.empty()) {
 		this->loading_vehicles.front()->LeaveStation();
 	}
@@ -470,6 +475,98 @@ bool Station::CatchmentCoversTown(TownID t) const
 	return false;
 }
 
+/** A station covering a tile, in the catchment index. */
+struct CatchmentIndexEntry {
+	StationID station; ///< The station.
+	uint32_t next;     ///< Next entry for the same tile, or StationsCoveringTile::END.
+};
+
+/*
+ * Index of the stations whose catchment covers a tile. It mirrors Station::catchment_tiles, so a
+ * lookup gives the same stations as testing every nearby station with Station::TileIsInCatchment.
+ * Every map tile has the first entry of a list of the stations covering it. The entries of all
+ * tiles share one array and freed entries are reused, so a covered tile does not allocate memory
+ * of its own. This costs 4 bytes per map tile plus 8 bytes per station for each tile it covers.
+ */
+static std::vector<uint32_t> _catchment_index_first; ///< First entry for each map tile, empty while no station is indexed.
+static std::vector<CatchmentIndexEntry> _catchment_index_entries; ///< All entries of the catchment index.
+static uint32_t _catchment_index_free = StationsCoveringTile::END; ///< First entry of the list of unused entries.
+
+/**
+ * Drop the whole catchment index, e.g. when all stations are removed at once.
+ */
+static void ResetCatchmentIndex()
+{
+	_catchment_index_first.clear();
+	_catchment_index_entries.clear();
+	_catchment_index_free = StationsCoveringTile::END;
+}
+
+/**
+ * Add this station to the catchment index for all tiles in its catchment.
+ */
+void Station::AddToCatchmentIndex()
+{
+	if (_catchment_index_first.size() != Map::Size()) _catchment_index_first.assign(Map::Size(), StationsCoveringTile::END);
+
+	BitmapTileIterator it(this->catchment_tiles);
+	for (TileIndex tile = it; tile != INVALID_TILE; tile = ++it) {
+		uint32_t entry = _catchment_index_free;
+		if (entry != StationsCoveringTile::END) {
+			_catchment_index_free = _catchment_index_entries[entry].next;
+		} else {
+			entry = static_cast<uint32_t>(_catchment_index_entries.size());
+			_catchment_index_entries.emplace_back();
+		}
+
+		_catchment_index_entries[entry] = {this->index, _catchment_index_first[tile.base()]};
+		_catchment_index_first[tile.base()] = entry;
+	}
+}
+
+/**
+ * Remove this station from the catchment index for all tiles in its catchment.
+ */
+void Station::RemoveFromCatchmentIndex()
+{
+	if (_catchment_index_first.size() != Map::Size()) return;
+
+	BitmapTileIterator it(this->catchment_tiles);
+	for (TileIndex tile = it; tile != INVALID_TILE; tile = ++it) {
+		for (uint32_t *link = &_catchment_index_first[tile.base()]; *link != StationsCoveringTile::END; link = &_catchment_index_entries[*link].next) {
+			uint32_t entry = *link;
+			if (_catchment_index_entries[entry].station != this->index) continue;
+
+			*link = _catchment_index_entries[entry].next;
+			_catchment_index_entries[entry].next = _catchment_index_free;
+			_catchment_index_free = entry;
+			break;
+		}
+	}
+}
+
+/**
+ * Get the stations whose catchment covers a tile.
+ * @param tile Tile to look up.
+ * @return Stations covering the tile, in no particular order.
+ */
+/* static */ StationsCoveringTile Station::GetStationsCoveringTile(TileIndex tile)
+{
+	if (tile.base() >= _catchment_index_first.size()) return {StationsCoveringTile::END};
+	return {_catchment_index_first[tile.base()]};
+}
+
+Station *StationsCoveringTile::Iterator::operator*() const
+{
+	return Station::Get(_catchment_index_entries[this->pos].station);
+}
+
+StationsCoveringTile::Iterator &StationsCoveringTile::Iterator::operator++()
+{
+	this->pos = _catchment_index_entries[this->pos].next;
+	return *this;
+}
+
 /**
  * Recompute tiles covered in our catchment area.
  * This will additionally recompute nearby towns and industries.
@@ -479,6 +576,7 @@ void Station::RecomputeCatchment(bool no_clear_nearby_lists)
 {
 	this->industries_near.clear();
 	if (!no_clear_nearby_lists) this->RemoveFromAllNearbyLists();
+	this->RemoveFromCatchmentIndex();
 
 	if (this->rect.IsEmpty()) {
 		this->catchment_tiles.Reset();
@@ -500,6 +598,7 @@ void Station::RecomputeCatchment(bool no_clear_nearby_lists)
 		this->industry->stations_near.clear();
 		this->industry->stations_near.insert(this);
 		this->industries_near.insert(IndustryListEntry{0, this->industry});
+		this->AddToCatchmentIndex();
 		return;
 	}
 
@@ -517,6 +616,7 @@ void Station::RecomputeCatchment(bool no_clear_nearby_lists)
 		TileArea ta2 = TileArea(tile, 1, 1).Expand(r);
 		for (TileIndex tile2 : ta2) this->catchment_tiles.SetTile(tile2);
 	}
+	this->AddToCatchmentIndex();
 
 	/* Search catchment tiles for towns and industries */
 	BitmapTileIterator it(this->catchment_tiles);
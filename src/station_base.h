@@ -516,6 +516,27 @@ struct IndustryCompare {
 
 typedef std::set<IndustryListEntry, IndustryCompare> IndustryList;
 
+/** The stations whose catchment covers a tile, see Station::GetStationsCoveringTile(). */
+class StationsCoveringTile {
+public:
+	static constexpr uint32_t END = UINT32_MAX; ///< Entry index marking the end of a list.
+
+	/** Iterator over the stations in the list. */
+	struct Iterator {
+		uint32_t pos; ///< Index of the current entry in the catchment index, or #END.
+
+		bool operator==(const Iterator &other) const { return this->pos == other.pos; }
+		Station *operator*() const;
+		Iterator &operator++();
+	};
+
+	uint32_t first; ///< Index of the first entry in the catchment index, or #END.
+
+	Iterator begin() const { return {this->first}; }
+	Iterator end() const { return {END}; }
+	bool empty() const { return this->first == END; }
+};
+
 /** Station data structure */
 struct Station final : SpecializedStation<Station, false> {
 public:
@@ -569,6 +590,7 @@ public:
 	uint GetPlatformLength(TileIndex tile) const override;
 	void RecomputeCatchment(bool no_clear_nearby_lists = false);
 	static void RecomputeCatchmentForAll();
+	static StationsCoveringTile GetStationsCoveringTile(TileIndex tile);
 
 	uint GetCatchmentRadius() const;
 	Rect GetCatchmentRect() const;
@@ -576,6 +598,8 @@ public:
 	void AddIndustryToDeliver(Industry *ind, TileIndex tile);
 	void RemoveIndustryToDeliver(Industry *ind);
 	void RemoveFromAllNearbyLists();
+	void AddToCatchmentIndex();
+	void RemoveFromCatchmentIndex();
 
 	inline bool TileIsInCatchment(TileIndex tile) const
 	{
@@ -4552,10 +4552,10 @@ void CcMoveStationName(Commands, const CommandCost &result, StationID station_id
 		SetViewportStationRect(st, false);
 	}
 
-static void AddNearbyStationsByCatchment(TileIndex tile, StationList &stations, StationList &nearby)
+static void AddNearbyStationsByCatchment(TileIndex tile, StationList &stations)
 {
-	for (Station *st : nearby) {
-		if (st->TileIsInCatchment(tile)) stations.insert(st);
+	for (Station *st : Station::GetStationsCoveringTile(tile)) {
+		stations.insert(st);
 	}
 }
 
@@ -4567,9 +4567,9 @@ const StationList &StationFinder::GetStations()
 {
 	if (this->tile != INVALID_TILE) {
 		if (IsTileType(this->tile, MP_HOUSE)) {
-			/* Town nearby stations need to be filtered per tile. */
+			/* Houses only need the stations whose catchment covers this very tile. */
 			assert(this->w == 1 && this->h == 1);
-			AddNearbyStationsByCatchment(this->tile, this->stations, Town::GetByTile(this->tile)->stations_near);
+			AddNearbyStationsByCatchment(this->tile, this->stations);
 		} else {
 			ForAllStationsAroundTiles(*this, [this](Station *st, TileIndex) {
 				this->stations.insert(st);
@@ -4611,20 +4611,22 @@ uint MoveGoodsToStation(CargoType cargo, uint amount, Source source, const Stati
 
 	Station *first_station = nullptr;
 	typedef std::pair<Station *, uint> StationInfo;
-	std::vector<StationInfo> used_stations;
+	/* Houses call this from the tile loop for every cargo they produce, so keep
+	 * the buffer around instead of allocating it again for each call. */
+	static std::vector<StationInfo> used_stations;
+	used_stations.clear();
 
 	for (Station *st : all_stations) {
 		if (exclusivity != INVALID_OWNER && exclusivity != st->owner) continue;
 		if (!CanMoveGoodsToStation(st, cargo)) continue;
 
-		/* Avoid allocating a vector if there is only one station to significantly
+		/* Avoid filling the vector if there is only one station to significantly
 		 * improve performance in this common case. */
 		if (first_station == nullptr) {
 			first_station = st;
 			continue;
 		}
 		if (used_stations.empty()) {
-			used_stations.reserve(2);
 			used_stations.emplace_back(first_station, 0);
 		}
 		used_stations.emplace_back(st, 0);
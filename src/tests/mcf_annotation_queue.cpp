@@ -0,0 +1,136 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file mcf_annotation_queue.cpp Test the priority queue of the MCF Dijkstra. */
+
+#include "../stdafx.h"
+
+#include "../3rdparty/catch2/catch.hpp"
+
+#include "../linkgraph/mcf.h"
+
+#include "../safeguards.h"
+
+/** Annotation with a freely settable value; lower values go first, ties are broken by node. */
+class TestAnnotation : public Path {
+public:
+	uint value;
+
+	TestAnnotation(NodeID n, uint value) : Path(n), value(value) {}
+
+	struct Comparator {
+		bool operator()(const TestAnnotation *x, const TestAnnotation *y) const
+		{
+			return x != y && (x->value != y->value ? x->value < y->value : x->GetNode() < y->GetNode());
+		}
+	};
+};
+
+using TestSet = std::set<TestAnnotation *, TestAnnotation::Comparator>;
+
+/**
+ * Pop all annotations from a queue.
+ * @param queue The queue to empty.
+ * @return The nodes in the order they were popped.
+ */
+static std::vector<NodeID> PopAll(AnnotationQueue<TestAnnotation> &queue)
+{
+	std::vector<NodeID> order;
+	while (!queue.IsEmpty()) order.push_back(queue.Pop()->GetNode());
+	return order;
+}
+
+TEST_CASE("AnnotationQueue - pop order")
+{
+	std::vector<Path *> heap;
+	std::vector<uint> index;
+
+	std::vector<TestAnnotation> annos;
+	for (uint value : {5, 3, 8, 3, 1, 8, 0, 5}) annos.emplace_back(static_cast<NodeID>(annos.size()), value);
+
+	AnnotationQueue<TestAnnotation> queue(heap, index, static_cast<uint>(annos.size()));
+	CHECK(queue.IsEmpty());
+	for (TestAnnotation &anno : annos) queue.Update(&anno);
+
+	/* Equal values are taken in order of their node. */
+	CHECK(PopAll(queue) == std::vector<NodeID>{6, 4, 1, 3, 0, 7, 2, 5});
+	CHECK(queue.IsEmpty());
+}
+
+TEST_CASE("AnnotationQueue - update in place")
+{
+	std::vector<Path *> heap;
+	std::vector<uint> index;
+
+	std::vector<TestAnnotation> annos;
+	for (uint value : {10, 20, 30, 40, 50}) annos.emplace_back(static_cast<NodeID>(annos.size()), value);
+
+	AnnotationQueue<TestAnnotation> queue(heap, index, static_cast<uint>(annos.size()));
+	for (TestAnnotation &anno : annos) queue.Update(&anno);
+
+	/* Improving a queued annotation moves it forward without queueing it twice. */
+	annos[4].value = 15;
+	queue.Update(&annos[4]);
+	annos[2].value = 10;
+	queue.Update(&annos[2]);
+	CHECK(heap.size() == annos.size());
+
+	CHECK(queue.Pop()->GetNode() == 0);
+
+	/* A popped annotation can be queued again. */
+	annos[0].value = 25;
+	queue.Update(&annos[0]);
+
+	CHECK(PopAll(queue) == std::vector<NodeID>{2, 4, 1, 0, 3});
+}
+
+TEST_CASE("AnnotationQueue - same order as std::set")
+{
+	/* The queue replaces a std::set, so the Dijkstra must take nodes in exactly the same order. */
+	std::vector<Path *> heap;
+	std::vector<uint> index;
+	uint32_t seed = 12345;
+	auto random = [&seed](uint limit) {
+		seed = seed * 1103515245 + 12345;
+		return (seed >> 16) % limit;
+	};
+
+	for (uint round = 0; round < 20; round++) {
+		const uint size = 1 + random(64);
+		std::vector<TestAnnotation> annos;
+		for (uint node = 0; node < size; node++) annos.emplace_back(static_cast<NodeID>(node), random(16));
+
+		AnnotationQueue<TestAnnotation> queue(heap, index, size);
+		TestSet set;
+		for (TestAnnotation &anno : annos) {
+			queue.Update(&anno);
+			set.insert(&anno);
+		}
+
+		std::vector<NodeID> queue_order;
+		std::vector<NodeID> set_order;
+		while (!set.empty()) {
+			REQUIRE_FALSE(queue.IsEmpty());
+			TestAnnotation *first = *set.begin();
+			set.erase(set.begin());
+			set_order.push_back(first->GetNode());
+			queue_order.push_back(queue.Pop()->GetNode());
+
+			/* Improve some of the remaining annotations, like the Dijkstra does. */
+			for (uint i = random(4); i > 0 && !set.empty(); i--) {
+				TestAnnotation &anno = annos[random(size)];
+				if (set.find(&anno) == set.end() || anno.value == 0) continue;
+				set.erase(&anno);
+				anno.value = random(anno.value);
+				set.insert(&anno);
+				queue.Update(&anno);
+			}
+		}
+		CHECK(queue.IsEmpty());
+		CHECK(queue_order == set_order);
+	}
+}
@@ -0,0 +1,140 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file station_catchment.cpp Test the index of stations by the catchment tiles they cover. */
+
+#include "../stdafx.h"
+
+#include "../3rdparty/catch2/catch.hpp"
+
+#include "mock_environment.h"
+
+#include "../clear_map.h"
+#include "../map_func.h"
+#include "../settings_type.h"
+#include "../station_base.h"
+#include "../station_kdtree.h"
+#include "../station_map.h"
+
+#include "../safeguards.h"
+
+/**
+ * Build a rail station, like the station construction does as far as the catchment is concerned.
+ * @param x X coordinate of the northern tile.
+ * @param y Y coordinate of the northern tile.
+ * @param w Width of the station.
+ * @param h Height of the station.
+ * @return The new station.
+ */
+static Station *BuildTestStation(uint x, uint y, uint w, uint h)
+{
+	TileIndex tile = TileXY(x, y);
+	Station *st = new Station(tile);
+	_station_kdtree.Insert(st->index);
+
+	st->train_station = TileArea(tile, w, h);
+	st->rect.BeforeAddRect(tile, w, h, StationRect::ADD_FORCE);
+	for (TileIndex t : st->train_station) MakeRailStation(t, OWNER_NONE, st->index, AXIS_X, 0, RAILTYPE_RAIL);
+
+	st->RecomputeCatchment();
+	return st;
+}
+
+/**
+ * Get the stations the catchment index lists for a tile.
+ * @param tile The tile.
+ * @return The listed stations.
+ */
+static std::set<StationID> GetIndexedStations(TileIndex tile)
+{
+	std::set<StationID> stations;
+	for (const Station *st : Station::GetStationsCoveringTile(tile)) stations.insert(st->index);
+	return stations;
+}
+
+/** Check that the catchment index lists exactly the stations whose catchment covers a tile, for every tile. */
+static void CheckCatchmentIndex()
+{
+	for (const auto tile : Map::Iterate()) {
+		std::set<StationID> expected;
+		for (const Station *st : Station::Iterate()) {
+			if (st->TileIsInCatchment(tile)) expected.insert(st->index);
+		}
+
+		std::set<StationID> indexed = GetIndexedStations(tile);
+		INFO("tile " << TileX(tile) << "x" << TileY(tile));
+		REQUIRE(indexed == expected);
+		/* A station is listed only once. */
+		size_t listed = 0;
+		for ([[maybe_unused]] const Station *st : Station::GetStationsCoveringTile(tile)) listed++;
+		REQUIRE(listed == indexed.size());
+	}
+}
+
+TEST_CASE("Station - catchment index")
+{
+	MockEnvironment::Instance();
+	Map::Allocate(64, 64);
+	_settings_game.station.modified_catchment = true;
+
+	Station *a = BuildTestStation(10, 10, 2, 1);
+	Station *b = BuildTestStation(16, 10, 1, 1);
+	Station *c = BuildTestStation(40, 40, 1, 3);
+
+	/* Rail stations cover four tiles around them. */
+	CHECK(GetIndexedStations(TileXY(14, 10)) == std::set<StationID>{a->index, b->index});
+	CHECK(GetIndexedStations(TileXY(8, 14)) == std::set<StationID>{a->index});
+	CHECK(GetIndexedStations(TileXY(41, 46)) == std::set<StationID>{c->index});
+	CHECK(GetIndexedStations(TileXY(30, 30)).empty());
+	CheckCatchmentIndex();
+
+	SECTION("Recompute after growing")
+	{
+		a->train_station = TileArea(TileXY(10, 10), 2, 3);
+		a->rect.BeforeAddRect(TileXY(10, 10), 2, 3, StationRect::ADD_FORCE);
+		for (TileIndex t : a->train_station) MakeRailStation(t, OWNER_NONE, a->index, AXIS_X, 0, RAILTYPE_RAIL);
+		a->RecomputeCatchment();
+
+		CHECK(GetIndexedStations(TileXY(10, 16)) == std::set<StationID>{a->index});
+		CheckCatchmentIndex();
+	}
+
+	SECTION("Recompute after shrinking")
+	{
+		MakeClear(TileXY(11, 10), CLEAR_GRASS, 3);
+		a->train_station = TileArea(TileXY(10, 10), 1, 1);
+		a->rect.AfterRemoveTile(a, TileXY(11, 10));
+		a->RecomputeCatchment();
+
+		CHECK(GetIndexedStations(TileXY(15, 10)) == std::set<StationID>{b->index});
+		CheckCatchmentIndex();
+	}
+
+	SECTION("Recompute after removing all tiles")
+	{
+		MakeClear(TileXY(16, 10), CLEAR_GRASS, 3);
+		b->train_station = TileArea();
+		b->rect.AfterRemoveTile(b, TileXY(16, 10));
+		b->RecomputeCatchment();
+
+		CHECK(GetIndexedStations(TileXY(16, 10)).empty());
+		CheckCatchmentIndex();
+	}
+
+	SECTION("Delete")
+	{
+		StationID removed = b->index;
+		delete b;
+
+		CHECK(GetIndexedStations(TileXY(14, 10)) == std::set<StationID>{a->index});
+		for (const auto tile : Map::Iterate()) REQUIRE(GetIndexedStations(tile).count(removed) == 0);
+		CheckCatchmentIndex();
+	}
+
+	for (Station *st : Station::Iterate()) delete st;
+	CHECK(GetIndexedStations(TileXY(14, 10)).empty());
+}
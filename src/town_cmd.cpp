@@ -1923,12 +1923,11 @@ static bool CanFollowRoad(TileIndex tile, DiagDirection dir, TownExpandModes mod
 	if (!IsValidTile(target_tile)) return false;
 	if (HasTileWaterGround(target_tile)) return false;
 
-	RoadBits target_rb = GetTownRoadBits(target_tile);
 	if (TownAllowedToBuildRoads(modes)) {
 		/* Check whether a road connection exists or can be build. */
 		switch (GetTileType(target_tile)) {
 			case MP_ROAD:
-				return target_rb != ROAD_NONE;
+				return GetTownRoadBits(target_tile) != ROAD_NONE;
 
 			case MP_STATION:
 				return IsDriveThroughStopTile(target_tile);
@@ -1948,6 +1947,7 @@ static bool CanFollowRoad(TileIndex tile, DiagDirection dir, TownExpandModes mod
 	} else {
 		/* Check whether a road connection already exists,
 		 * and it leads somewhere else. */
+		RoadBits target_rb = GetTownRoadBits(target_tile);
 		RoadBits back_rb = DiagDirToRoadBits(ReverseDiagDir(dir));
 		return (target_rb & back_rb) != 0 && (target_rb & ~back_rb) != 0;
 	}
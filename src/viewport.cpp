@@ -220,9 +220,13 @@ struct ViewportDrawer {
 	Point foundation_offset[FOUNDATION_PART_END];    ///< Pixel offset for ground sprites on the foundations.
 
 	citymania::TileHighlight cm_highlight;
+
+	Viewport *landscape_cache_vp;                    ///< Viewport whose ground layer cache is used by the current draw, or \c nullptr.
+	bool landscape_cache_reuse;                      ///< Whether valid cached ground layer blocks may be blitted instead of drawing the tile sprites.
+	bool landscape_cache_hit;                        ///< Whether the ground layer of the current draw comes from the cache, so tile sprites are not collected.
 };
 
-static bool MarkViewportDirty(Viewport &vp, int left, int top, int right, int bottom);
+static bool MarkViewportDirty(Viewport &vp, int left, int top, int right, int bottom, ViewportMarkDirtyFlags flags = {});
 
 static ViewportDrawer _vd;
 
@@ -412,6 +416,7 @@ static void SetViewportPosition(Window *w, int x, int y)
 	int i;
 	int left, top, width, height;
 
+	if (vp.virtual_left != x || vp.virtual_top != y) vp.InvalidateLandscapeCache();
 	vp.virtual_left = x;
 	vp.virtual_top = y;
 	UpdateViewportDirtyBlockLeftMargin(vp);
@@ -573,6 +578,8 @@ static void AddTileSpriteToDraw(SpriteID image, PaletteID pal, int32_t x, int32_
 {
 	assert((image & SPRITE_MASK) < MAX_SPRITES);
 
+	if (_vd.landscape_cache_hit) return;
+
 	TileSpriteToDraw &ts = _vd.tile_sprites_to_draw.emplace_back();
 	ts.image = image;
 	ts.pal = pal;
@@ -1892,6 +1899,137 @@ static void ViewportDrawStrings(ZoomLevel zoom, const StringSpriteToDrawVector *
 	}
 }
 
+/**
+ * Call \a proc for every dirty block of the viewport that intersects a screen area.
+ * @param vp The viewport.
+ * @param left Left edge of the area, in screen coordinates.
+ * @param top Top edge of the area, in screen coordinates.
+ * @param width Width of the area.
+ * @param height Height of the area.
+ * @param proc Called with the block index, the screen area of the block clipped to the viewport, and whether that area lies completely inside the given area.
+ */
+template <typename T>
+static void IterateLandscapeCacheBlocks(const Viewport &vp, int left, int top, int width, int height, T proc)
+{
+	int x0 = std::max(0, left - vp.left);
+	int y0 = std::max(0, top - vp.top);
+	int x1 = std::min(vp.width, left + width - vp.left);
+	int y1 = std::min(vp.height, top + height - vp.top);
+	if (x0 >= x1 || y0 >= y1) return;
+
+	const uint margin = vp.dirty_block_left_margin;
+	const uint w_shift = vp.GetDirtyBlockWidthShift();
+	const uint h_shift = vp.GetDirtyBlockHeightShift();
+	const uint bx_last = std::min<uint>(std::max(0, x1 - 1 - (int)margin) >> w_shift, vp.dirty_blocks_per_row - 1);
+	const uint by_last = std::min<uint>((y1 - 1) >> h_shift, vp.dirty_blocks_per_column - 1);
+
+	for (uint bx = std::max(0, x0 - (int)margin) >> w_shift; bx <= bx_last; bx++) {
+		/* The first column also covers the left margin. */
+		int bl = bx == 0 ? 0 : margin + (bx << w_shift);
+		int br = std::min<int>(vp.width, margin + ((bx + 1) << w_shift));
+		for (uint by = y0 >> h_shift; by <= by_last; by++) {
+			int bt = by << h_shift;
+			int bb = std::min<int>(vp.height, (by + 1) << h_shift);
+			bool inside = bl >= x0 && br <= x1 && bt >= y0 && bb <= y1;
+			proc(bx * vp.dirty_blocks_per_column + by, vp.left + bl, vp.top + bt, br - bl, bb - bt, inside);
+		}
+	}
+}
+
+/**
+ * Get the size of a block in the ground layer cache of a viewport.
+ * @param vp The viewport.
+ * @param blitter The blitter the cached pixels are for.
+ * @param first_column Whether the block is in the first column, which also covers the left margin.
+ * @return Size of a block in bytes.
+ */
+static size_t GetLandscapeCacheBlockSize(const Viewport &vp, Blitter *blitter, bool first_column)
+{
+	uint width = vp.GetDirtyBlockWidth() + (first_column ? vp.dirty_block_left_margin : 0);
+	return blitter->BufferSize(width, vp.GetDirtyBlockHeight());
+}
+
+/**
+ * Get where a block starts in the ground layer cache of a viewport.
+ * The blocks of the first column come first, as they are larger than the others.
+ * @param vp The viewport.
+ * @param pos Index of the dirty block, or the number of blocks to get the size of the whole cache.
+ * @return Offset of the block in #Viewport::landscape_cache.
+ */
+static size_t GetLandscapeCacheOffset(const Viewport &vp, uint pos)
+{
+	if (pos <= vp.dirty_blocks_per_column) return pos * vp.landscape_cache_first_block_size;
+	return vp.dirty_blocks_per_column * vp.landscape_cache_first_block_size + (pos - vp.dirty_blocks_per_column) * vp.landscape_cache_block_size;
+}
+
+/**
+ * Check whether the ground layer of an area can be taken from the cache of a viewport.
+ * That is the case when every block touched by the area lies completely inside it and has a valid cache entry.
+ * @param vp The viewport.
+ * @param left Left edge of the area, in screen coordinates.
+ * @param top Top edge of the area, in screen coordinates.
+ * @param width Width of the area.
+ * @param height Height of the area.
+ * @return Whether RestoreLandscapeCache() can be used instead of drawing the tile sprites.
+ */
+static bool CanRestoreLandscapeCache(const Viewport &vp, int left, int top, int width, int height)
+{
+	Blitter *blitter = BlitterFactory::GetCurrentBlitter();
+	if (vp.landscape_cache_block_size != GetLandscapeCacheBlockSize(vp, blitter, false)) return false;
+	if (vp.landscape_cache_first_block_size != GetLandscapeCacheBlockSize(vp, blitter, true)) return false;
+
+	bool usable = true;
+	IterateLandscapeCacheBlocks(vp, left, top, width, height, [&](uint pos, int, int, int, int, bool inside) {
+		if (!inside || !vp.landscape_cache_valid[pos]) usable = false;
+	});
+	return usable;
+}
+
+/**
+ * Blit the cached ground layer of a viewport to the screen.
+ * @param vp The viewport.
+ * @param left Left edge of the area, in screen coordinates.
+ * @param top Top edge of the area, in screen coordinates.
+ * @param width Width of the area.
+ * @param height Height of the area.
+ * @pre CanRestoreLandscapeCache()
+ */
+static void RestoreLandscapeCache(const Viewport &vp, int left, int top, int width, int height)
+{
+	Blitter *blitter = BlitterFactory::GetCurrentBlitter();
+	IterateLandscapeCacheBlocks(vp, left, top, width, height, [&](uint pos, int x, int y, int w, int h, bool) {
+		blitter->CopyFromBuffer(blitter->MoveTo(_screen.dst_ptr, x, y), vp.landscape_cache.data() + GetLandscapeCacheOffset(vp, pos), w, h);
+	});
+}
+
+/**
+ * Store the freshly drawn ground layer of a viewport in its cache.
+ * Blocks only partially inside the area can not be stored and are invalidated instead.
+ * @param vp The viewport.
+ * @param left Left edge of the area, in screen coordinates.
+ * @param top Top edge of the area, in screen coordinates.
+ * @param width Width of the area.
+ * @param height Height of the area.
+ */
+static void StoreLandscapeCache(Viewport &vp, int left, int top, int width, int height)
+{
+	Blitter *blitter = BlitterFactory::GetCurrentBlitter();
+	size_t block_size = GetLandscapeCacheBlockSize(vp, blitter, false);
+	size_t first_block_size = GetLandscapeCacheBlockSize(vp, blitter, true);
+	if (vp.landscape_cache_block_size != block_size || vp.landscape_cache_first_block_size != first_block_size ||
+			vp.landscape_cache.size() != GetLandscapeCacheOffset(vp, (uint)vp.landscape_cache_valid.size())) {
+		vp.landscape_cache_block_size = block_size;
+		vp.landscape_cache_first_block_size = first_block_size;
+		vp.landscape_cache.assign(GetLandscapeCacheOffset(vp, (uint)vp.landscape_cache_valid.size()), 0);
+		vp.InvalidateLandscapeCache();
+	}
+
+	IterateLandscapeCacheBlocks(vp, left, top, width, height, [&](uint pos, int x, int y, int w, int h, bool inside) {
+		if (inside) blitter->CopyToBuffer(blitter->MoveTo(_screen.dst_ptr, x, y), vp.landscape_cache.data() + GetLandscapeCacheOffset(vp, pos), w, h);
+		vp.landscape_cache_valid[pos] = inside;
+	});
+}
+
 void ViewportDoDraw(const Viewport &vp, int left, int top, int right, int bottom)
 {
 	_vd.dpi.zoom = vp.zoom;
@@ -1912,6 +2050,12 @@ void ViewportDoDraw(const Viewport &vp, int left, int top, int right, int bottom
 	_vd.dpi.dst_ptr = BlitterFactory::GetCurrentBlitter()->MoveTo(_cur_dpi->dst_ptr, x - _cur_dpi->left, y - _cur_dpi->top);
 	AutoRestoreBackup dpi_backup(_cur_dpi, &_vd.dpi);
 
+	Viewport *cache_vp = _vd.landscape_cache_vp;
+	int cache_width = UnScaleByZoom(_vd.dpi.width, vp.zoom);
+	int cache_height = UnScaleByZoom(_vd.dpi.height, vp.zoom);
+	bool cache_hit = cache_vp != nullptr && _vd.landscape_cache_reuse && CanRestoreLandscapeCache(*cache_vp, x, y, cache_width, cache_height);
+	AutoRestoreBackup cache_hit_backup(_vd.landscape_cache_hit, cache_hit);
+
 	ViewportAddLandscape();
 	ViewportAddVehicles(&_vd.dpi);
 
@@ -1919,7 +2063,12 @@ void ViewportDoDraw(const Viewport &vp, int left, int top, int right, int bottom
 
 	DrawTextEffects(&_vd.dpi);
 
-	if (!_vd.tile_sprites_to_draw.empty()) ViewportDrawTileSprites(&_vd.tile_sprites_to_draw);
+	if (cache_hit) {
+		RestoreLandscapeCache(*cache_vp, x, y, cache_width, cache_height);
+	} else {
+		if (!_vd.tile_sprites_to_draw.empty()) ViewportDrawTileSprites(&_vd.tile_sprites_to_draw);
+		if (cache_vp != nullptr) StoreLandscapeCache(*cache_vp, x, y, cache_width, cache_height);
+	}
 
 	for (auto &psd : _vd.parent_sprites_to_draw) {
 		_vd.parent_sprites_to_sort.push_back(&psd);
@@ -1961,7 +2110,18 @@ void ViewportDoDraw(const Viewport &vp, int left, int top, int right, int bottom
 	_vd.child_screen_sprites_to_draw.clear();
 }
 
-void ViewportDrawChk(const Viewport &vp, int left, int top, int right, int bottom) {
+/**
+ * Redraw dirty blocks of a viewport.
+ * Blocks that were only dirtied by non-landscape changes get their ground layer from the viewport's cache.
+ * @param vp The viewport.
+ * @param left Left edge of the area, in screen coordinates.
+ * @param top Top edge of the area, in screen coordinates.
+ * @param right Right edge of the area, in screen coordinates.
+ * @param bottom Bottom edge of the area, in screen coordinates.
+ */
+void ViewportDrawChk(Viewport &vp, int left, int top, int right, int bottom) {
+	AutoRestoreBackup cache_vp_backup(_vd.landscape_cache_vp, &vp);
+	AutoRestoreBackup cache_reuse_backup(_vd.landscape_cache_reuse, true);
 	ViewportDoDraw(vp,
 		ScaleByZoom(left - vp.left, vp.zoom) + vp.virtual_left,
 		ScaleByZoom(top - vp.top, vp.zoom) + vp.virtual_top,
@@ -1986,6 +2146,9 @@ static inline void ViewportDraw(Viewport &vp, int left, int top, int right, int
 
 	vp.is_drawn = true;
 
+	/* Always draw the ground layer as the window might be redrawn because of changes that did not mark the viewport dirty. */
+	AutoRestoreBackup cache_vp_backup(_vd.landscape_cache_vp, &vp);
+	AutoRestoreBackup cache_reuse_backup(_vd.landscape_cache_reuse, false);
 	ViewportDoDraw(vp,
 		ScaleByZoom(left - vp.left, vp.zoom) + vp.virtual_left,
 		ScaleByZoom(top - vp.top, vp.zoom) + vp.virtual_top,
@@ -2145,6 +2308,7 @@ void UpdateViewportSizeZoom(Viewport &vp)
 	vp.dirty_blocks_per_row = CeilDiv(vp.width, vp.GetDirtyBlockWidth());
 	uint size = vp.dirty_blocks_per_row * vp.dirty_blocks_per_column;
 	vp.dirty_blocks.assign(size, false);
+	vp.landscape_cache_valid.assign(size, false);
 	UpdateViewportDirtyBlockLeftMargin(vp);
 
 	// if (vp->zoom >= ZOOM_LVL_DRAW_MAP) {
@@ -2172,10 +2336,11 @@ void UpdateViewportSizeZoom(Viewport &vp)
  * @param top    Top edge of area to repaint
  * @param right  Right edge of area to repaint
  * @param bottom Bottom edge of area to repaint
+ * @param flags  What kind of change caused the repaint.
  * @return true if the viewport contains a dirty block
  * @ingroup dirty
  */
-static bool MarkViewportDirty(Viewport &vp, int left, int top, int right, int bottom)
+static bool MarkViewportDirty(Viewport &vp, int left, int top, int right, int bottom, ViewportMarkDirtyFlags flags)
 {
 	/* Rounding wrt. zoom-out level */
 	right += (1 << to_underlying(vp.zoom)) - 1;
@@ -2207,12 +2372,14 @@ static bool MarkViewportDirty(Viewport &vp, int left, int top, int right, int bo
 	h -= std::max((int)y + (int)h - (int)vp.dirty_blocks_per_column, 0);
 	w -= std::max((int)x + (int)w - (int)vp.dirty_blocks_per_row, 0);
 
+	const bool landscape = !flags.Test(ViewportMarkDirtyFlag::NotLandscape);
 	uint column_skip = vp.dirty_blocks_per_column - h;
 	uint pos = (x * vp.dirty_blocks_per_column) + y;
 	for (int i = 0; i < w; i++) {
 		for (int j = 0; j < h; j++) {
 
 			vp.dirty_blocks[pos] = true;
+			if (landscape) vp.landscape_cache_valid[pos] = false;
 			pos++;
 		}
 		pos += column_skip;
@@ -2241,10 +2408,11 @@ static bool MarkViewportDirty(Viewport &vp, int left, int top, int right, int bo
  * @param top    Top    edge of area to repaint. (viewport coordinates, that is wrt. #ZoomLevel::Min)
  * @param right  Right  edge of area to repaint. (viewport coordinates, that is wrt. #ZoomLevel::Min)
  * @param bottom Bottom edge of area to repaint. (viewport coordinates, that is wrt. #ZoomLevel::Min)
+ * @param flags  What kind of change caused the repaint.
  * @return true if at least one viewport has a dirty block
  * @ingroup dirty
  */
-bool MarkAllViewportsDirty(int left, int top, int right, int bottom)
+bool MarkAllViewportsDirty(int left, int top, int right, int bottom, ViewportMarkDirtyFlags flags)
 {
 	bool dirty = false;
 
@@ -2252,7 +2420,7 @@ bool MarkAllViewportsDirty(int left, int top, int right, int bottom)
 		auto &vp = w->viewport;
 		if (vp != nullptr) {
 			assert(vp->width != 0);
-			if (MarkViewportDirty(*vp, left, top, right, bottom)) dirty = true;
+			if (MarkViewportDirty(*vp, left, top, right, bottom, flags)) dirty = true;
 		}
 	}
 
@@ -25,6 +25,12 @@ enum class ViewportStringFlag : uint8_t {
 };
 using ViewportStringFlags = EnumBitSet<ViewportStringFlag, uint8_t>;
 
+/** Flags to describe what part of a viewport is marked dirty. */
+enum class ViewportMarkDirtyFlag : uint8_t {
+	NotLandscape, ///< Only non-landscape parts changed (e.g. a moving vehicle), the cached ground layer stays valid.
+};
+using ViewportMarkDirtyFlags = EnumBitSet<ViewportMarkDirtyFlag, uint8_t>;
+
 /**
  * Data structure for viewport, display of a part of the world
  */
@@ -49,6 +55,11 @@ struct Viewport {
 	bool is_dirty = false;
 	bool is_drawn = false;
 
+	std::vector<bool> landscape_cache_valid; ///< Per dirty block: whether #landscape_cache holds its current ground layer.
+	std::vector<uint8_t> landscape_cache;    ///< Ground layer pixels of every dirty block, in the format of Blitter::CopyToBuffer.
+	size_t landscape_cache_block_size = 0;   ///< Size of a single block in #landscape_cache.
+	size_t landscape_cache_first_block_size = 0; ///< Size of a block of the first column in #landscape_cache, which also covers the left margin.
+
 	uint GetDirtyBlockWidthShift() const { return this->GetDirtyBlockShift(); }
 	uint GetDirtyBlockHeightShift() const { return this->GetDirtyBlockShift(); }
 	uint GetDirtyBlockWidth() const { return 1 << this->GetDirtyBlockWidthShift(); }
@@ -63,6 +74,12 @@ struct Viewport {
 		this->is_drawn = false;
 	}
 
+	/** Mark the whole cached ground layer as outdated. */
+	void InvalidateLandscapeCache()
+	{
+		this->landscape_cache_valid.assign(this->landscape_cache_valid.size(), false);
+	}
+
 private:
 	uint GetDirtyBlockShift() const
 	{
@@ -3171,6 +3171,7 @@ void UpdateWindows()
 
 	PerformanceMeasurer framerate(PFE_DRAWING);
 	PerformanceAccumulator::Reset(PFE_DRAWWORLD);
+	PerformanceAccumulator::Reset(PFE_SPRITECACHE);
 
 	ProcessPendingPerformanceMeasurements();
 